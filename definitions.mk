@@ -11,9 +11,11 @@ BUILD_DIR = build
 TEST_DIR = test
 UNIT_TEST_DIR = unit
 INTEGRATION_TEST_DIR = integration
+BENCHMARK_DIR = benchmark
 MOCK_DIR = mock
 SIS_MODULE_SRC_DIR = sis
 TIMER_SRC_DIR = Timer
+TRACE_SRC_DIR = Trace
 UART_SRC_DIR = Uart
 UTILS_SRC_DIR = Utils
 SYSTEM_CONFIG_SRC_DIR = SystemConfig
@@ -63,9 +63,9 @@ Timer_Apbctrl1_init(Timer_Id id, Timer_Apbctrl1 *const timer, const Timer_Interr
 {
 #ifdef MOCK_REGISTERS
     if (timer->base == NULL) {
-        timer->base = malloc(sizeof(Timer_Apbctrl1_Base_Registers));
+        timer->base = malloc(sizeof(*timer->base));
     }
-    timer->regs = malloc(sizeof(Timer_Apbctrl1_Registers));
+    timer->regs = malloc(sizeof(*timer->regs));
 #else
     timer->base = (Timer_Apbctrl1_Base_Registers) GPTIMER_APBCTRL1_ADDRESS_BASE;
     timer->regs = getApbctrl1TimerAddressById(id);
@@ -183,9 +183,9 @@ Timer_Apbctrl2_init(Timer_Id id, Timer_Apbctrl2 *const timer, const Timer_Interr
 {
 #ifdef MOCK_REGISTERS
     if (timer->base == NULL) {
-        timer->base = malloc(sizeof(Timer_Apbctrl2_Base_Registers));
+        timer->base = malloc(sizeof(*timer->base));
     }
-    timer->regs = malloc(sizeof(Timer_Apbctrl2_Registers));
+    timer->regs = malloc(sizeof(*timer->regs));
 #else
     timer->base = (Timer_Apbctrl2_Base_Registers) GPTIMER_APBCTRL2_ADDRESS_BASE;
     timer->regs = getApbctrl2TimerAddressById(id);
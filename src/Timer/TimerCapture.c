@@ -0,0 +1,135 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimerCapture.h"
+#include "Timer_private.h"
+
+#define TIMER_CAPTURE_COUNTER_RELOAD 0xFFFFFFFFu
+
+static inline void
+enableLatching(Timer_Capture* const capture)
+{
+    Timer_setFlag(&capture->timer->base->configuration, TIMER_FLAG_SET, TIMER_CONFIG_EL);
+}
+
+bool
+Timer_Capture_init(Timer_Capture* const capture,
+                   const Timer_Id id,
+                   Timer_Apbctrl2* const timer,
+                   Timer_CaptureEvent* const events,
+                   const uint32_t capacity)
+{
+    if (capacity == 0 || (capacity & (capacity - 1u)) != 0) {
+        return false;
+    }
+
+    Timer_Apbctrl2_init(id, timer, defaultInterruptHandler);
+    capture->timer = timer;
+    capture->events = events;
+    capture->mask = capacity - 1u;
+    capture->head = 0;
+    capture->tail = 0;
+    capture->overrunCount = 0;
+    capture->lastTimestamp = 0;
+    capture->hasLastTimestamp = false;
+
+    return true;
+}
+
+void
+Timer_Capture_start(Timer_Capture* const capture, const uint32_t interruptMask)
+{
+    const Timer_Config config = { .isInterruptEnabled = false,
+                                  .isEnabled = false,
+                                  .isAutoReloaded = true,
+                                  .isChained = false,
+                                  .reloadValue = TIMER_CAPTURE_COUNTER_RELOAD };
+
+    Timer_Capture_stop(capture);
+    capture->head = 0;
+    capture->tail = 0;
+    capture->overrunCount = 0;
+    capture->hasLastTimestamp = false;
+
+    Timer_Apbctrl2_setConfigRegisters(capture->timer, &config);
+    Timer_Apbctrl2_start(capture->timer);
+    capture->timer->base->latchConfiguration = interruptMask;
+    enableLatching(capture);
+}
+
+void
+Timer_Capture_stop(Timer_Capture* const capture)
+{
+    Timer_setFlag(&capture->timer->base->configuration, TIMER_FLAG_RESET, TIMER_CONFIG_EL);
+    capture->timer->base->latchConfiguration = 0;
+    Timer_Apbctrl2_stop(capture->timer);
+}
+
+bool
+Timer_Capture_handleEvent(Timer_Capture* const capture)
+{
+    // Counter runs down from all ones, so its complement counts up from 0
+    const uint32_t timestamp = ~capture->timer->regs->latch;
+    enableLatching(capture);
+
+    const uint32_t head = capture->head;
+    if ((head - __atomic_load_n(&capture->tail, __ATOMIC_ACQUIRE)) > capture->mask) {
+        capture->overrunCount++;
+        return false;
+    }
+
+    // Deltas are measured between stored events, so consecutive ring entries
+    // stay consistent when events are dropped
+    const uint32_t delta = capture->hasLastTimestamp ? timestamp - capture->lastTimestamp : 0;
+    capture->lastTimestamp = timestamp;
+    capture->hasLastTimestamp = true;
+    capture->events[head & capture->mask] = (Timer_CaptureEvent){ .timestamp = timestamp, .delta = delta };
+    __atomic_store_n(&capture->head, head + 1u, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool
+Timer_Capture_read(Timer_Capture* const capture, Timer_CaptureEvent* const event)
+{
+    const uint32_t tail = capture->tail;
+    if (__atomic_load_n(&capture->head, __ATOMIC_ACQUIRE) == tail) {
+        return false;
+    }
+
+    *event = capture->events[tail & capture->mask];
+    __atomic_store_n(&capture->tail, tail + 1u, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint32_t
+Timer_Capture_getCount(const Timer_Capture* const capture)
+{
+    return capture->head - capture->tail;
+}
+
+uint32_t
+Timer_Capture_getOverrunCount(const Timer_Capture* const capture)
+{
+    return capture->overrunCount;
+}
@@ -0,0 +1,114 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Input capture timestamping external events with the Apbctrl2
+///        timer latch registers.
+
+/**
+ * @defgroup Timer Timer
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_TIMER_CAPTURE_H
+#define BSP_TIMER_CAPTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Timer.h"
+
+/// \brief Captured event.
+typedef struct
+{
+    uint32_t timestamp; ///< Ticks elapsed since Timer_Capture_start, wrapping at 2^32
+    uint32_t delta;     ///< Ticks elapsed since the previous stored event, 0 for the first one
+} Timer_CaptureEvent;
+
+/// \brief Input capture descriptor. Events are pushed by the interrupt handler
+///        of the latching line and pulled by a single consumer without any
+///        interrupt masking.
+typedef struct
+{
+    Timer_Apbctrl2* timer;          ///< Free-running timer providing the timebase
+    Timer_CaptureEvent* events;     ///< Timestamp ring storage
+    uint32_t mask;                  ///< Capacity of the ring minus one
+    volatile uint32_t head;         ///< Index of next captured event
+    volatile uint32_t tail;         ///< Index of oldest unread event
+    volatile uint32_t overrunCount; ///< Number of events dropped on a full ring
+    uint32_t lastTimestamp;         ///< Timestamp of the previous stored event
+    bool hasLastTimestamp;          ///< Is there a previous stored event
+} Timer_Capture;
+
+/// \brief Initializes an Apbctrl2 timer as the capture timebase, counting in
+///        ticks set by its base scaler.
+/// \param [out] capture Capture descriptor.
+/// \param [in] id Timer device identifier.
+/// \param [out] timer Timer device descriptor, kept alive while in use.
+/// \param [in] events Timestamp ring storage.
+/// \param [in] capacity Number of events in the storage, has to be a power of two.
+/// \returns Whether the capacity is valid.
+bool Timer_Capture_init(Timer_Capture* const capture,
+                        const Timer_Id id,
+                        Timer_Apbctrl2* const timer,
+                        Timer_CaptureEvent* const events,
+                        const uint32_t capacity);
+
+/// \brief Starts the timebase from 0 and enables latching of the timer
+///        counters on the selected interrupt lines.
+/// \param [in] capture Capture descriptor.
+/// \param [in] interruptMask Latching interrupt lines, bit n selecting
+///             interrupt n.
+void Timer_Capture_start(Timer_Capture* const capture, const uint32_t interruptMask);
+
+/// \brief Disables latching and stops the timebase.
+/// \param [in] capture Capture descriptor.
+void Timer_Capture_stop(Timer_Capture* const capture);
+
+/// \brief Records the latched counter value and enables latching of the next
+///        event, which the hardware disables after each latch. Called from
+///        the interrupt handler of the latching line.
+/// \param [in] capture Capture descriptor.
+/// \returns Whether the event was stored, false if the ring is full.
+bool Timer_Capture_handleEvent(Timer_Capture* const capture);
+
+/// \brief Pulls the oldest captured event.
+/// \param [in] capture Capture descriptor.
+/// \param [out] event Captured event.
+/// \returns Whether there was an unread event.
+bool Timer_Capture_read(Timer_Capture* const capture, Timer_CaptureEvent* const event);
+
+/// \brief Gets the number of unread events.
+/// \param [in] capture Capture descriptor.
+/// \returns Number of unread events.
+uint32_t Timer_Capture_getCount(const Timer_Capture* const capture);
+
+/// \brief Gets the number of events dropped since Timer_Capture_start
+///        because the ring was full.
+/// \param [in] capture Capture descriptor.
+/// \returns Number of dropped events.
+uint32_t Timer_Capture_getOverrunCount(const Timer_Capture* const capture);
+
+#endif // BSP_TIMER_CAPTURE_H
+
+/** @} */
@@ -0,0 +1,123 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimerClock.h"
+
+#define TIMER_CLOCK_COUNTER_RELOAD 0xFFFFFFFFu
+
+static inline uint64_t
+readDownCounter(const Timer_Clock* const clock)
+{
+    uint32_t high = clock->high.regs->counter;
+    uint32_t low;
+    uint32_t highAgain;
+
+    // The high half decrements when the low one underflows, so a low value
+    // is only paired with the high value read on both sides of it
+    for (;;) {
+        low = clock->low.regs->counter;
+        highAgain = clock->high.regs->counter;
+        if (highAgain == high) {
+            break;
+        }
+        high = highAgain;
+    }
+
+    return ((uint64_t)high << 32u) | low;
+}
+
+bool
+Timer_Clock_init(Timer_Clock* const clock, const Timer_Id lowId, const uint32_t tickFrequency)
+{
+    if (lowId < Timer_Id_1 || lowId >= Timer_Id_4 || tickFrequency == 0) {
+        return false;
+    }
+
+    Timer_Apbctrl1_init(lowId, &clock->low, defaultInterruptHandler);
+    clock->high.base = clock->low.base;
+    Timer_Apbctrl1_init((Timer_Id)(lowId + 1), &clock->high, defaultInterruptHandler);
+    clock->tickFrequency = tickFrequency;
+    clock->nanosecondsPerTick = (TIMER_CLOCK_NANOSECONDS_PER_SECOND % tickFrequency) == 0
+                                        ? TIMER_CLOCK_NANOSECONDS_PER_SECOND / tickFrequency
+                                        : 0;
+
+    return true;
+}
+
+void
+Timer_Clock_start(Timer_Clock* const clock)
+{
+    const Timer_Config lowConfig = { .isInterruptEnabled = false,
+                                     .isEnabled = false,
+                                     .isAutoReloaded = true,
+                                     .isChained = false,
+                                     .reloadValue = TIMER_CLOCK_COUNTER_RELOAD };
+    const Timer_Config highConfig = { .isInterruptEnabled = false,
+                                      .isEnabled = false,
+                                      .isAutoReloaded = true,
+                                      .isChained = true,
+                                      .reloadValue = TIMER_CLOCK_COUNTER_RELOAD };
+
+    Timer_Apbctrl1_stop(&clock->low);
+    Timer_Apbctrl1_stop(&clock->high);
+    Timer_Apbctrl1_setConfigRegisters(&clock->high, &highConfig);
+    Timer_Apbctrl1_setConfigRegisters(&clock->low, &lowConfig);
+    // High timer is armed first so it sees the first underflow of the low one
+    Timer_Apbctrl1_start(&clock->high);
+    Timer_Apbctrl1_start(&clock->low);
+}
+
+void
+Timer_Clock_shutdown(Timer_Clock* const clock)
+{
+    Timer_Apbctrl1_shutdown(&clock->low);
+    Timer_Apbctrl1_shutdown(&clock->high);
+}
+
+uint64_t
+Timer_Clock_getTicks(const Timer_Clock* const clock)
+{
+    // Both counters start from all ones and count down
+    return ~readDownCounter(clock);
+}
+
+uint64_t
+Timer_Clock_ticksToNanoseconds(const Timer_Clock* const clock, const uint64_t ticks)
+{
+    if (clock->nanosecondsPerTick != 0) {
+        return ticks * clock->nanosecondsPerTick;
+    }
+
+    // Split on whole seconds so the multiplication cannot overflow
+    const uint64_t seconds = ticks / clock->tickFrequency;
+    const uint64_t remainder = ticks % clock->tickFrequency;
+    return seconds * TIMER_CLOCK_NANOSECONDS_PER_SECOND
+           + (remainder * TIMER_CLOCK_NANOSECONDS_PER_SECOND) / clock->tickFrequency;
+}
+
+uint64_t
+Timer_Clock_getNanoseconds(const Timer_Clock* const clock)
+{
+    return Timer_Clock_ticksToNanoseconds(clock, Timer_Clock_getTicks(clock));
+}
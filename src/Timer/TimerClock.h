@@ -0,0 +1,89 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief 64-bit monotonic clock built from a pair of chained Apbctrl1 timers.
+
+/**
+ * @defgroup Timer Timer
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_TIMER_CLOCK_H
+#define BSP_TIMER_CLOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Timer.h"
+
+#define TIMER_CLOCK_NANOSECONDS_PER_SECOND 1000000000u
+
+/// \brief Monotonic clock descriptor. The low timer counts scaler ticks and
+///        the high timer, chained to it, counts underflows of the low one.
+typedef struct
+{
+    Timer_Apbctrl1 low;          ///< Free-running timer counting ticks
+    Timer_Apbctrl1 high;         ///< Timer chained to the low one
+    uint32_t tickFrequency;      ///< Tick frequency in Hz, set by the base scaler
+    uint32_t nanosecondsPerTick; ///< Tick length when it is a whole number of nanoseconds, 0 otherwise
+} Timer_Clock;
+
+/// \brief Initializes the clock on a timer and the one following it, which
+///        is the only one the hardware can chain to it.
+/// \param [out] clock Clock descriptor.
+/// \param [in] lowId Identifier of the low timer, Timer_Id_1 to Timer_Id_3.
+/// \param [in] tickFrequency Tick frequency in Hz, i.e. system clock
+///             frequency divided by base scaler reload value plus one.
+/// \returns Whether the timers and frequency are valid.
+bool Timer_Clock_init(Timer_Clock* const clock, const Timer_Id lowId, const uint32_t tickFrequency);
+
+/// \brief Reloads both counters and starts counting from 0.
+/// \param [in] clock Clock descriptor.
+void Timer_Clock_start(Timer_Clock* const clock);
+
+/// \brief Stops both timers and releases their interrupts.
+/// \param [in] clock Clock descriptor.
+void Timer_Clock_shutdown(Timer_Clock* const clock);
+
+/// \brief Reads the number of ticks elapsed since Timer_Clock_start. Both
+///        halves are read consistently without disabling interrupts, so it is
+///        safe to call from interrupt handlers on any processor.
+/// \param [in] clock Clock descriptor.
+/// \returns Elapsed ticks.
+uint64_t Timer_Clock_getTicks(const Timer_Clock* const clock);
+
+/// \brief Converts a tick count of the clock to nanoseconds.
+/// \param [in] clock Clock descriptor.
+/// \param [in] ticks Number of ticks, e.g. a difference of two readings.
+/// \returns Number of nanoseconds, rounded down.
+uint64_t Timer_Clock_ticksToNanoseconds(const Timer_Clock* const clock, const uint64_t ticks);
+
+/// \brief Reads the number of nanoseconds elapsed since Timer_Clock_start.
+/// \param [in] clock Clock descriptor.
+/// \returns Elapsed nanoseconds.
+uint64_t Timer_Clock_getNanoseconds(const Timer_Clock* const clock);
+
+#endif // BSP_TIMER_CLOCK_H
+
+/** @} */
@@ -0,0 +1,232 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimerDeadline.h"
+
+#define TIMER_DEADLINE_MAX_DELTA 0xFFFFFFFFu
+
+static inline uint64_t
+getTime(const Timer_DeadlineScheduler* const scheduler)
+{
+    return Timer_Clock_getTicks(scheduler->clock);
+}
+
+static inline void
+disarm(Timer_DeadlineScheduler* const scheduler)
+{
+    Timer_Apbctrl1_stop(scheduler->timer);
+    scheduler->isArmed = false;
+}
+
+static inline void
+arm(Timer_DeadlineScheduler* const scheduler, const uint64_t now)
+{
+    const uint64_t expiry = scheduler->head->expiry;
+    const uint64_t remaining = expiry > now ? expiry - now : 1u;
+    // Deadlines beyond the counter range are reached in several expiries
+    const uint32_t delta = remaining > TIMER_DEADLINE_MAX_DELTA ? TIMER_DEADLINE_MAX_DELTA : (uint32_t)remaining;
+    const Timer_Config config = { .isInterruptEnabled = true,
+                                  .isEnabled = false,
+                                  .isAutoReloaded = false,
+                                  .isChained = false,
+                                  .reloadValue = delta - 1u };
+
+    // The timer starts after the clock was read and counts the same ticks,
+    // so it never underflows before the clock reaches now + delta
+    Timer_Apbctrl1_setConfigRegisters(scheduler->timer, &config);
+    Timer_Apbctrl1_start(scheduler->timer);
+    scheduler->armedExpiry = now + delta;
+    scheduler->isArmed = true;
+}
+
+static inline void
+insertDeadline(Timer_DeadlineScheduler* const scheduler, Timer_Deadline* const deadline)
+{
+    Timer_Deadline** link = &scheduler->head;
+    // Deadlines with equal expiry are dispatched in scheduling order
+    while (*link != NULL && (*link)->expiry <= deadline->expiry) {
+        link = &(*link)->next;
+    }
+    deadline->next = *link;
+    *link = deadline;
+}
+
+static inline void
+removeDeadline(Timer_DeadlineScheduler* const scheduler, Timer_Deadline* const deadline)
+{
+    Timer_Deadline** link = &scheduler->head;
+    while (*link != deadline) {
+        link = &(*link)->next;
+    }
+    *link = deadline->next;
+    deadline->next = NULL;
+}
+
+static inline void
+scheduleDeadline(Timer_DeadlineScheduler* const scheduler,
+                 Timer_Deadline* const deadline,
+                 const uint64_t now,
+                 const uint64_t expiry)
+{
+    if (deadline->isPending) {
+        removeDeadline(scheduler, deadline);
+    }
+    deadline->expiry = expiry;
+    deadline->isPending = true;
+    insertDeadline(scheduler, deadline);
+
+    // Timer is only reprogrammed when it would fire too late
+    if (scheduler->head == deadline && (!scheduler->isArmed || deadline->expiry < scheduler->armedExpiry)) {
+        arm(scheduler, now);
+    }
+}
+
+static void
+handleTimerInterrupt(volatile void* arg)
+{
+    Timer_DeadlineScheduler_handleExpiry((Timer_DeadlineScheduler*)arg);
+}
+
+void
+Timer_DeadlineScheduler_init(Timer_DeadlineScheduler* const scheduler,
+                             const Timer_Id id,
+                             Timer_Apbctrl1* const timer,
+                             const Timer_Clock* const clock)
+{
+    const Timer_InterruptHandler handler = { .callback = handleTimerInterrupt, .arg = scheduler };
+
+    timer->base = clock->low.base;
+    Timer_Apbctrl1_init(id, timer, handler);
+    scheduler->timer = timer;
+    scheduler->clock = clock;
+    scheduler->head = NULL;
+    scheduler->armedExpiry = 0;
+    scheduler->isArmed = false;
+    rtems_interrupt_lock_initialize(&scheduler->lock, "TimerDeadline");
+}
+
+void
+Timer_DeadlineScheduler_initDeadline(Timer_Deadline* const deadline, const Timer_InterruptHandler handler)
+{
+    deadline->next = NULL;
+    deadline->handler = handler;
+    deadline->expiry = 0;
+    deadline->isPending = false;
+}
+
+void
+Timer_DeadlineScheduler_schedule(Timer_DeadlineScheduler* const scheduler,
+                                 Timer_Deadline* const deadline,
+                                 const uint64_t timeout)
+{
+    rtems_interrupt_lock_context lockContext;
+    rtems_interrupt_lock_acquire(&scheduler->lock, &lockContext);
+    const uint64_t now = getTime(scheduler);
+    scheduleDeadline(scheduler, deadline, now, now + (timeout > 0 ? timeout : 1u));
+    rtems_interrupt_lock_release(&scheduler->lock, &lockContext);
+}
+
+void
+Timer_DeadlineScheduler_scheduleAt(Timer_DeadlineScheduler* const scheduler,
+                                   Timer_Deadline* const deadline,
+                                   const uint64_t expiry)
+{
+    rtems_interrupt_lock_context lockContext;
+    rtems_interrupt_lock_acquire(&scheduler->lock, &lockContext);
+    scheduleDeadline(scheduler, deadline, getTime(scheduler), expiry);
+    rtems_interrupt_lock_release(&scheduler->lock, &lockContext);
+}
+
+bool
+Timer_DeadlineScheduler_cancel(Timer_DeadlineScheduler* const scheduler, Timer_Deadline* const deadline)
+{
+    rtems_interrupt_lock_context lockContext;
+    rtems_interrupt_lock_acquire(&scheduler->lock, &lockContext);
+
+    const bool wasPending = deadline->isPending;
+    if (wasPending) {
+        removeDeadline(scheduler, deadline);
+        deadline->isPending = false;
+        // Timer left armed for a cancelled earliest deadline fires early
+        // and rearms for the next one, it is only stopped when none is left
+        if (scheduler->head == NULL && scheduler->isArmed) {
+            disarm(scheduler);
+        }
+    }
+
+    rtems_interrupt_lock_release(&scheduler->lock, &lockContext);
+    return wasPending;
+}
+
+bool
+Timer_DeadlineScheduler_isPending(const Timer_Deadline* const deadline)
+{
+    return deadline->isPending;
+}
+
+uint64_t
+Timer_DeadlineScheduler_getTime(Timer_DeadlineScheduler* const scheduler)
+{
+    return getTime(scheduler);
+}
+
+uint32_t
+Timer_DeadlineScheduler_handleExpiry(Timer_DeadlineScheduler* const scheduler)
+{
+    rtems_interrupt_lock_context lockContext;
+    rtems_interrupt_lock_acquire(&scheduler->lock, &lockContext);
+
+    // Interrupt of a timer disarmed or rearmed in the meantime is stale
+    if (!scheduler->isArmed || !Timer_Apbctrl1_hasFinished(scheduler->timer)) {
+        rtems_interrupt_lock_release(&scheduler->lock, &lockContext);
+        return 0;
+    }
+    scheduler->isArmed = false;
+
+    // Callbacks run without the lock and may schedule deadlines, arming the
+    // timer on their own. Deadlines falling due while they run are
+    // dispatched in the same interrupt.
+    uint32_t dispatched = 0;
+    uint64_t now = getTime(scheduler);
+    while (scheduler->head != NULL && scheduler->head->expiry <= now) {
+        Timer_Deadline* const deadline = scheduler->head;
+        scheduler->head = deadline->next;
+        deadline->next = NULL;
+        deadline->isPending = false;
+        const Timer_InterruptHandler handler = deadline->handler;
+
+        rtems_interrupt_lock_release(&scheduler->lock, &lockContext);
+        handler.callback(handler.arg);
+        dispatched++;
+        rtems_interrupt_lock_acquire(&scheduler->lock, &lockContext);
+        now = getTime(scheduler);
+    }
+
+    if (scheduler->head != NULL && !scheduler->isArmed) {
+        arm(scheduler, now);
+    }
+
+    rtems_interrupt_lock_release(&scheduler->lock, &lockContext);
+    return dispatched;
+}
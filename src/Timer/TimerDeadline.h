@@ -0,0 +1,129 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Tickless deadline scheduler reprogramming a one-shot Apbctrl1 timer
+///        to the earliest pending deadline, with time read from a free-running
+///        Timer_Clock.
+
+/**
+ * @defgroup Timer Timer
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_TIMER_DEADLINE_H
+#define BSP_TIMER_DEADLINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Timer.h"
+#include "TimerClock.h"
+
+/// \brief Deadline descriptor, allocated by the user and kept alive while
+///        pending.
+typedef struct Timer_Deadline
+{
+    struct Timer_Deadline* next;    ///< Next pending deadline, ordered by expiry
+    Timer_InterruptHandler handler; ///< Callback run from the timer interrupt on expiry
+    uint64_t expiry;                ///< Clock time at which the deadline expires
+    bool isPending;                 ///< Is deadline scheduled and not yet dispatched
+} Timer_Deadline;
+
+/// \brief Deadline scheduler descriptor. The timer is armed only while a
+///        deadline is pending, so interrupts occur on expiries alone.
+typedef struct
+{
+    Timer_Apbctrl1* timer;     ///< One-shot timer
+    const Timer_Clock* clock;  ///< Clock giving scheduler time
+    Timer_Deadline* head;      ///< Earliest pending deadline
+    uint64_t armedExpiry;      ///< Clock time at which the armed timer underflows at the earliest
+    bool isArmed;              ///< Is the timer counting down to armedExpiry
+    RTEMS_INTERRUPT_LOCK_MEMBER(lock)
+} Timer_DeadlineScheduler;
+
+/// \brief Initializes a scheduler on an idle Apbctrl1 timer. Scheduler time
+///        is the time of the clock, which keeps running while no deadline is
+///        pending, so expiries do not accumulate interrupt latency.
+/// \param [out] scheduler Scheduler descriptor.
+/// \param [in] id Timer device identifier, other than the clock timers.
+/// \param [out] timer Timer device descriptor, kept alive while in use.
+/// \param [in] clock Started clock of the same timer unit, so that both
+///             count ticks of the same base scaler, kept alive while in use.
+void Timer_DeadlineScheduler_init(Timer_DeadlineScheduler* const scheduler,
+                                  const Timer_Id id,
+                                  Timer_Apbctrl1* const timer,
+                                  const Timer_Clock* const clock);
+
+/// \brief Initializes an idle deadline.
+/// \param [out] deadline Deadline descriptor.
+/// \param [in] handler Callback and its argument run on expiry.
+void Timer_DeadlineScheduler_initDeadline(Timer_Deadline* const deadline, const Timer_InterruptHandler handler);
+
+/// \brief Schedules a deadline relative to the current time, rescheduling it
+///        if pending, and rearms the timer if it became the earliest one. Can
+///        be called from the deadline callbacks.
+/// \param [in] scheduler Scheduler descriptor.
+/// \param [in] deadline Deadline descriptor.
+/// \param [in] timeout Number of ticks after which the deadline expires,
+///             at least 1.
+void Timer_DeadlineScheduler_schedule(Timer_DeadlineScheduler* const scheduler,
+                                      Timer_Deadline* const deadline,
+                                      const uint64_t timeout);
+
+/// \brief Schedules a deadline at an absolute clock time, like
+///        Timer_DeadlineScheduler_schedule. A callback rescheduling its
+///        deadline at the previous expiry plus a period keeps a fixed rate
+///        regardless of the time the callback runs at.
+/// \param [in] scheduler Scheduler descriptor.
+/// \param [in] deadline Deadline descriptor.
+/// \param [in] expiry Clock time of the expiry, a past time expires at once.
+void Timer_DeadlineScheduler_scheduleAt(Timer_DeadlineScheduler* const scheduler,
+                                        Timer_Deadline* const deadline,
+                                        const uint64_t expiry);
+
+/// \brief Cancels a deadline, stopping the timer if no other is pending.
+/// \param [in] scheduler Scheduler descriptor.
+/// \param [in] deadline Deadline descriptor.
+/// \returns Whether the deadline was pending.
+bool Timer_DeadlineScheduler_cancel(Timer_DeadlineScheduler* const scheduler, Timer_Deadline* const deadline);
+
+/// \brief Checks whether a deadline is scheduled and its callback did not run yet.
+/// \param [in] deadline Deadline descriptor.
+/// \returns Whether the deadline is pending.
+bool Timer_DeadlineScheduler_isPending(const Timer_Deadline* const deadline);
+
+/// \brief Gets the scheduler time.
+/// \param [in] scheduler Scheduler descriptor.
+/// \returns Number of clock ticks elapsed since Timer_Clock_start.
+uint64_t Timer_DeadlineScheduler_getTime(Timer_DeadlineScheduler* const scheduler);
+
+/// \brief Runs callbacks of all expired deadlines and rearms the timer for
+///        the next one. Called from the timer interrupt.
+/// \param [in] scheduler Scheduler descriptor.
+/// \returns Number of dispatched callbacks.
+uint32_t Timer_DeadlineScheduler_handleExpiry(Timer_DeadlineScheduler* const scheduler);
+
+#endif // BSP_TIMER_DEADLINE_H
+
+/** @} */
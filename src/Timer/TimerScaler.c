@@ -0,0 +1,248 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimerScaler.h"
+
+#define TIMER_SCALER_NANOSECONDS_PER_SECOND 1000000000u
+#define TIMER_SCALER_PPB 1000000000u
+#define TIMER_SCALER_PPB_PER_PPM 1000u
+// Requested periods are kept in thousandths of clock cycles
+#define TIMER_SCALER_CYCLE_FRACTION 1000u
+#define TIMER_SCALER_MAX_TICKS 0x100000000ull
+
+/// \brief Computes value * multiplier / divisor rounded down, without
+///        overflow of the intermediate product as long as the result fits.
+static inline uint64_t
+multiplyDivide(const uint64_t value, const uint32_t multiplier, const uint32_t divisor)
+{
+    const uint64_t quotient = value / divisor;
+    const uint64_t remainder = value % divisor;
+    return quotient * multiplier + (remainder * multiplier) / divisor;
+}
+
+static inline bool
+getRequestedCycles(const uint32_t clockFrequency, const Timer_PeriodRequest* const request, uint64_t* const cycles)
+{
+    if (request->frequencyHz != 0) {
+        *cycles = ((uint64_t)clockFrequency * TIMER_SCALER_CYCLE_FRACTION) / request->frequencyHz;
+    } else {
+        // Period of more than 2^64 thousandths of a cycle is beyond any scaler
+        const uint32_t nanosecondsPerFraction = TIMER_SCALER_NANOSECONDS_PER_SECOND / TIMER_SCALER_CYCLE_FRACTION;
+        if ((request->periodNs / nanosecondsPerFraction) > (UINT64_MAX / clockFrequency)) {
+            return false;
+        }
+        *cycles = multiplyDivide(request->periodNs, clockFrequency, nanosecondsPerFraction);
+    }
+    return *cycles != 0;
+}
+
+static inline uint64_t
+getTicks(const uint64_t requestedCycles, const uint32_t divisor)
+{
+    const uint64_t cyclesPerTick = (uint64_t)divisor * TIMER_SCALER_CYCLE_FRACTION;
+    return (requestedCycles + cyclesPerTick / 2u) / cyclesPerTick;
+}
+
+/// \brief Computes the period error in parts per billion, fine enough to
+///        tell exact settings from sub-ppm ones.
+static inline int64_t
+getErrorPpb(const uint64_t requestedCycles, const uint64_t ticks, const uint32_t divisor)
+{
+    const int64_t achievedCycles = (int64_t)(ticks * divisor * TIMER_SCALER_CYCLE_FRACTION);
+    // Difference is below one tick, so it cannot overflow when scaled
+    return ((achievedCycles - (int64_t)requestedCycles) * (int64_t)TIMER_SCALER_PPB) / (int64_t)requestedCycles;
+}
+
+static inline uint64_t
+getAbsoluteValue(const int64_t value)
+{
+    return value < 0 ? (uint64_t)(-value) : (uint64_t)value;
+}
+
+/// \brief Finds the largest error of all requests with the given scaler.
+/// \returns Whether every request has a reload value in range.
+static bool
+evaluateScaler(const uint32_t clockFrequency,
+               const Timer_PeriodRequest* const requests,
+               const uint32_t count,
+               const uint32_t divisor,
+               uint64_t* const maxError)
+{
+    *maxError = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t requestedCycles = 0;
+        (void)getRequestedCycles(clockFrequency, &requests[i], &requestedCycles);
+        const uint64_t ticks = getTicks(requestedCycles, divisor);
+        if (ticks == 0 || ticks > TIMER_SCALER_MAX_TICKS) {
+            return false;
+        }
+        const uint64_t error = getAbsoluteValue(getErrorPpb(requestedCycles, ticks, divisor));
+        if (error > *maxError) {
+            *maxError = error;
+        }
+    }
+    return true;
+}
+
+static bool
+computePeriodSettings(const uint32_t clockFrequency,
+                      const Timer_PeriodRequest* const requests,
+                      const uint32_t count,
+                      const uint32_t maxErrorPpm,
+                      const uint32_t maxScaler,
+                      uint32_t* const scalerReloadValue,
+                      Timer_PeriodSetting* const settings)
+{
+    if (clockFrequency == 0 || count == 0) {
+        return false;
+    }
+
+    uint64_t longestCycles = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t requestedCycles = 0;
+        if (!getRequestedCycles(clockFrequency, &requests[i], &requestedCycles)) {
+            return false;
+        }
+        if (requestedCycles > longestCycles) {
+            longestCycles = requestedCycles;
+        }
+    }
+
+    // Smaller scalers cannot fit the longest period in the reload register
+    const uint64_t maxTickCycles = TIMER_SCALER_MAX_TICKS * TIMER_SCALER_CYCLE_FRACTION;
+    const uint64_t minDivisor = (longestCycles + maxTickCycles - 1u) / maxTickCycles;
+    if (minDivisor > (uint64_t)maxScaler + 1u) {
+        return false;
+    }
+    const uint32_t firstScaler = minDivisor > (TIMER_SCALER_MIN + 1u) ? (uint32_t)minDivisor - 1u : TIMER_SCALER_MIN;
+
+    bool isFound = false;
+    uint32_t bestScaler = 0;
+    uint64_t bestError = 0;
+    for (uint32_t scaler = firstScaler; scaler <= maxScaler; scaler++) {
+        uint64_t error = 0;
+        if (!evaluateScaler(clockFrequency, requests, count, scaler + 1u, &error)) {
+            // Shortest period is below one tick, larger scalers only make it worse
+            if (isFound || scaler > firstScaler) {
+                break;
+            }
+            continue;
+        }
+        if (!isFound || error < bestError) {
+            isFound = true;
+            bestScaler = scaler;
+            bestError = error;
+        }
+        if (bestError == 0) {
+            break;
+        }
+    }
+
+    if (!isFound || bestError > (uint64_t)maxErrorPpm * TIMER_SCALER_PPB_PER_PPM) {
+        return false;
+    }
+
+    const uint32_t divisor = bestScaler + 1u;
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t requestedCycles = 0;
+        (void)getRequestedCycles(clockFrequency, &requests[i], &requestedCycles);
+        const uint64_t ticks = getTicks(requestedCycles, divisor);
+        settings[i].reloadValue = (uint32_t)(ticks - 1u);
+        settings[i].achievedPeriodNs = multiplyDivide(ticks * divisor, TIMER_SCALER_NANOSECONDS_PER_SECOND, clockFrequency);
+        settings[i].errorPpm = (int32_t)(getErrorPpb(requestedCycles, ticks, divisor) / TIMER_SCALER_PPB_PER_PPM);
+    }
+    *scalerReloadValue = bestScaler;
+
+    return true;
+}
+
+bool
+Timer_Apbctrl1_computePeriodSettings(const uint32_t clockFrequency,
+                                     const Timer_PeriodRequest* const requests,
+                                     const uint32_t count,
+                                     const uint32_t maxErrorPpm,
+                                     uint16_t* const scalerReloadValue,
+                                     Timer_PeriodSetting* const settings)
+{
+    uint32_t scaler = 0;
+    if (!computePeriodSettings(clockFrequency, requests, count, maxErrorPpm, TIMER_APBCTRL1_SCALER_MAX, &scaler, settings)) {
+        return false;
+    }
+    *scalerReloadValue = (uint16_t)scaler;
+    return true;
+}
+
+bool
+Timer_Apbctrl2_computePeriodSettings(const uint32_t clockFrequency,
+                                     const Timer_PeriodRequest* const requests,
+                                     const uint32_t count,
+                                     const uint32_t maxErrorPpm,
+                                     uint8_t* const scalerReloadValue,
+                                     Timer_PeriodSetting* const settings)
+{
+    uint32_t scaler = 0;
+    if (!computePeriodSettings(clockFrequency, requests, count, maxErrorPpm, TIMER_APBCTRL2_SCALER_MAX, &scaler, settings)) {
+        return false;
+    }
+    *scalerReloadValue = (uint8_t)scaler;
+    return true;
+}
+
+void
+Timer_Apbctrl1_applyPeriodSettings(Timer_Apbctrl1* const* const timers,
+                                   const uint32_t count,
+                                   const uint16_t scalerReloadValue,
+                                   const Timer_PeriodSetting* const settings)
+{
+    if (count == 0) {
+        return;
+    }
+
+    Timer_Apbctrl1_setBaseScalerReloadValue(timers[0], scalerReloadValue);
+    for (uint32_t i = 0; i < count; i++) {
+        Timer_Config config;
+        Timer_Apbctrl1_getConfigRegisters(timers[i], &config);
+        config.reloadValue = settings[i].reloadValue;
+        Timer_Apbctrl1_setConfigRegisters(timers[i], &config);
+    }
+}
+
+void
+Timer_Apbctrl2_applyPeriodSettings(Timer_Apbctrl2* const* const timers,
+                                   const uint32_t count,
+                                   const uint8_t scalerReloadValue,
+                                   const Timer_PeriodSetting* const settings)
+{
+    if (count == 0) {
+        return;
+    }
+
+    Timer_Apbctrl2_setBaseScalerReloadValue(timers[0], scalerReloadValue);
+    for (uint32_t i = 0; i < count; i++) {
+        Timer_Config config;
+        Timer_Apbctrl2_getConfigRegisters(timers[i], &config);
+        config.reloadValue = settings[i].reloadValue;
+        Timer_Apbctrl2_setConfigRegisters(timers[i], &config);
+    }
+}
@@ -0,0 +1,121 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Computation of the shared base scaler and per timer reload values
+///        of a timer group from requested periods or frequencies.
+
+/**
+ * @defgroup Timer Timer
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_TIMER_SCALER_H
+#define BSP_TIMER_SCALER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Timer.h"
+
+#define TIMER_SCALER_MIN 5u
+#define TIMER_APBCTRL1_SCALER_MAX 0xFFFFu
+#define TIMER_APBCTRL2_SCALER_MAX 0xFFu
+
+/// \brief Requested timer period, given either in nanoseconds or in Hz.
+typedef struct
+{
+    uint64_t periodNs;    ///< Requested period in ns, used when frequencyHz is 0
+    uint32_t frequencyHz; ///< Requested frequency in Hz, 0 to use periodNs
+} Timer_PeriodRequest;
+
+/// \brief Timer setting closest to a requested period.
+typedef struct
+{
+    uint32_t reloadValue;      ///< Timer reload register value, period is reloadValue + 1 ticks
+    uint64_t achievedPeriodNs; ///< Achieved period in ns, rounded down
+    int32_t errorPpm;          ///< Achieved minus requested period in parts per million
+} Timer_PeriodSetting;
+
+/// \brief Computes the base scaler shared by a group of Apbctrl1 timers and
+///        their reload values, minimizing the largest period error. Of equally
+///        good scalers the smallest one, giving the finest resolution, is
+///        chosen. Runs in time proportional to the scaler range, so it is
+///        meant for configuration time.
+/// \param [in] clockFrequency System clock frequency in Hz.
+/// \param [in] requests Requested periods, one per active timer.
+/// \param [in] count Number of requests.
+/// \param [in] maxErrorPpm Largest accepted period error in parts per million.
+/// \param [out] scalerReloadValue Base scaler reload value.
+/// \param [out] settings Timer settings, in order of the requests.
+/// \returns Whether all periods can be achieved within maxErrorPpm with one
+///          scaler, outputs are not modified otherwise.
+bool Timer_Apbctrl1_computePeriodSettings(const uint32_t clockFrequency,
+                                          const Timer_PeriodRequest* const requests,
+                                          const uint32_t count,
+                                          const uint32_t maxErrorPpm,
+                                          uint16_t* const scalerReloadValue,
+                                          Timer_PeriodSetting* const settings);
+
+/// \brief Computes the base scaler shared by a group of Apbctrl2 timers and
+///        their reload values, as Timer_Apbctrl1_computePeriodSettings.
+/// \param [in] clockFrequency System clock frequency in Hz.
+/// \param [in] requests Requested periods, one per active timer.
+/// \param [in] count Number of requests.
+/// \param [in] maxErrorPpm Largest accepted period error in parts per million.
+/// \param [out] scalerReloadValue Base scaler reload value.
+/// \param [out] settings Timer settings, in order of the requests.
+/// \returns Whether all periods can be achieved within maxErrorPpm with one
+///          scaler, outputs are not modified otherwise.
+bool Timer_Apbctrl2_computePeriodSettings(const uint32_t clockFrequency,
+                                          const Timer_PeriodRequest* const requests,
+                                          const uint32_t count,
+                                          const uint32_t maxErrorPpm,
+                                          uint8_t* const scalerReloadValue,
+                                          Timer_PeriodSetting* const settings);
+
+/// \brief Sets the base scaler of an Apbctrl1 timer group together with the
+///        reload values of all its active timers, keeping their other flags.
+/// \param [in] timers Active timers, in order of the settings.
+/// \param [in] count Number of timers.
+/// \param [in] scalerReloadValue Base scaler reload value.
+/// \param [in] settings Timer settings.
+void Timer_Apbctrl1_applyPeriodSettings(Timer_Apbctrl1* const* const timers,
+                                        const uint32_t count,
+                                        const uint16_t scalerReloadValue,
+                                        const Timer_PeriodSetting* const settings);
+
+/// \brief Sets the base scaler of an Apbctrl2 timer group together with the
+///        reload values of all its active timers, keeping their other flags.
+/// \param [in] timers Active timers, in order of the settings.
+/// \param [in] count Number of timers.
+/// \param [in] scalerReloadValue Base scaler reload value.
+/// \param [in] settings Timer settings.
+void Timer_Apbctrl2_applyPeriodSettings(Timer_Apbctrl2* const* const timers,
+                                        const uint32_t count,
+                                        const uint8_t scalerReloadValue,
+                                        const Timer_PeriodSetting* const settings);
+
+#endif // BSP_TIMER_SCALER_H
+
+/** @} */
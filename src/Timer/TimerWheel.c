@@ -0,0 +1,240 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TimerWheel.h"
+
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOTS - 1u)
+#define TIMER_WHEEL_MAX_DELTA ((uint32_t)((1ull << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS)) - 1u))
+
+#if (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS) > 32u
+#error "TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS has to fit the 32-bit wheel time"
+#endif
+
+static inline void
+initList(Timer_WheelNode* const head)
+{
+    head->next = head;
+    head->prev = head;
+}
+
+static inline bool
+isListEmpty(const Timer_WheelNode* const head)
+{
+    return head->next == head;
+}
+
+static inline void
+appendNode(Timer_WheelNode* const head, Timer_WheelNode* const node)
+{
+    node->next = head;
+    node->prev = head->prev;
+    head->prev->next = node;
+    head->prev = node;
+}
+
+static inline void
+unlinkNode(Timer_WheelNode* const node)
+{
+    node->prev->next = node->next;
+    node->next->prev = node->prev;
+}
+
+static inline void
+moveList(Timer_WheelNode* const from, Timer_WheelNode* const to)
+{
+    if (isListEmpty(from)) {
+        initList(to);
+        return;
+    }
+    to->next = from->next;
+    to->prev = from->prev;
+    to->next->prev = to;
+    to->prev->next = to;
+    initList(from);
+}
+
+static inline uint32_t
+getSlotIndex(const uint32_t time, const uint32_t level)
+{
+    return (time >> (level * TIMER_WHEEL_SLOT_BITS)) & TIMER_WHEEL_SLOT_MASK;
+}
+
+static inline void
+insertTimer(Timer_Wheel* const wheel, Timer_WheelTimer* const timer)
+{
+    uint32_t delta = timer->expiry - wheel->time;
+    if (delta > TIMER_WHEEL_MAX_DELTA) {
+        // Parked in the last level and cascaded again until it fits
+        delta = TIMER_WHEEL_MAX_DELTA;
+    }
+
+    uint32_t level = 0;
+    while (level < (TIMER_WHEEL_LEVELS - 1u) && delta >= (1u << ((level + 1u) * TIMER_WHEEL_SLOT_BITS))) {
+        level++;
+    }
+
+    const uint32_t slot = getSlotIndex(wheel->time + delta, level);
+    appendNode(&wheel->slots[level][slot], &timer->node);
+}
+
+static inline void
+cascade(Timer_Wheel* const wheel, const uint32_t level)
+{
+    Timer_WheelNode pending;
+    moveList(&wheel->slots[level][getSlotIndex(wheel->time, level)], &pending);
+
+    while (!isListEmpty(&pending)) {
+        Timer_WheelNode* const node = pending.next;
+        unlinkNode(node);
+        insertTimer(wheel, (Timer_WheelTimer*)node);
+    }
+}
+
+static void
+handleTickInterrupt(volatile void* arg)
+{
+    Timer_Wheel_tick((Timer_Wheel*)arg);
+}
+
+void
+Timer_Wheel_init(Timer_Wheel* const wheel)
+{
+    for (uint32_t level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+        for (uint32_t slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            initList(&wheel->slots[level][slot]);
+        }
+    }
+    initList(&wheel->expired);
+    wheel->time = 0;
+    rtems_interrupt_lock_initialize(&wheel->lock, "TimerWheel");
+}
+
+void
+Timer_Wheel_startApbctrl1(Timer_Wheel* const wheel,
+                          const Timer_Id id,
+                          Timer_Apbctrl1* const timer,
+                          const uint32_t tickPeriod)
+{
+    const Timer_InterruptHandler handler = { .callback = handleTickInterrupt, .arg = wheel };
+    // Timer underflows one tick after counting down from the reload value
+    const Timer_Config config = { .isInterruptEnabled = true,
+                                  .isEnabled = false,
+                                  .isAutoReloaded = true,
+                                  .isChained = false,
+                                  .reloadValue = tickPeriod > 0 ? tickPeriod - 1u : 0 };
+
+    Timer_Apbctrl1_init(id, timer, handler);
+    Timer_Apbctrl1_setConfigRegisters(timer, &config);
+    Timer_Apbctrl1_start(timer);
+}
+
+void
+Timer_Wheel_initTimer(Timer_WheelTimer* const timer, const Timer_InterruptHandler handler)
+{
+    initList(&timer->node);
+    timer->handler = handler;
+    timer->expiry = 0;
+    timer->isPending = false;
+}
+
+void
+Timer_Wheel_schedule(Timer_Wheel* const wheel, Timer_WheelTimer* const timer, const uint32_t timeout)
+{
+    rtems_interrupt_lock_context lockContext;
+    rtems_interrupt_lock_acquire(&wheel->lock, &lockContext);
+
+    if (timer->isPending) {
+        unlinkNode(&timer->node);
+    }
+    timer->expiry = wheel->time + (timeout > 0 ? timeout : 1u);
+    timer->isPending = true;
+    insertTimer(wheel, timer);
+
+    rtems_interrupt_lock_release(&wheel->lock, &lockContext);
+}
+
+bool
+Timer_Wheel_cancel(Timer_Wheel* const wheel, Timer_WheelTimer* const timer)
+{
+    rtems_interrupt_lock_context lockContext;
+    rtems_interrupt_lock_acquire(&wheel->lock, &lockContext);
+
+    const bool wasPending = timer->isPending;
+    if (wasPending) {
+        unlinkNode(&timer->node);
+        initList(&timer->node);
+        timer->isPending = false;
+    }
+
+    rtems_interrupt_lock_release(&wheel->lock, &lockContext);
+    return wasPending;
+}
+
+bool
+Timer_Wheel_isPending(const Timer_WheelTimer* const timer)
+{
+    return timer->isPending;
+}
+
+uint32_t
+Timer_Wheel_tick(Timer_Wheel* const wheel)
+{
+    rtems_interrupt_lock_context lockContext;
+    rtems_interrupt_lock_acquire(&wheel->lock, &lockContext);
+
+    wheel->time++;
+    // Higher levels are cascaded down when all slots below them have wrapped
+    for (uint32_t level = 1; level < TIMER_WHEEL_LEVELS; level++) {
+        if (getSlotIndex(wheel->time, level - 1u) != 0) {
+            break;
+        }
+        cascade(wheel, level);
+    }
+    moveList(&wheel->slots[0][getSlotIndex(wheel->time, 0)], &wheel->expired);
+
+    // Due timers are taken one at a time so that callbacks run without the
+    // lock and may schedule or cancel any timer, including the due ones
+    uint32_t dispatched = 0;
+    while (!isListEmpty(&wheel->expired)) {
+        Timer_WheelTimer* const timer = (Timer_WheelTimer*)wheel->expired.next;
+        unlinkNode(&timer->node);
+        initList(&timer->node);
+        timer->isPending = false;
+        const Timer_InterruptHandler handler = timer->handler;
+
+        rtems_interrupt_lock_release(&wheel->lock, &lockContext);
+        handler.callback(handler.arg);
+        dispatched++;
+        rtems_interrupt_lock_acquire(&wheel->lock, &lockContext);
+    }
+
+    rtems_interrupt_lock_release(&wheel->lock, &lockContext);
+    return dispatched;
+}
+
+uint32_t
+Timer_Wheel_getTime(const Timer_Wheel* const wheel)
+{
+    return wheel->time;
+}
@@ -0,0 +1,133 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Hierarchical timing wheel multiplexing software timers onto a
+///        single periodic Apbctrl1 timer interrupt.
+
+/**
+ * @defgroup Timer Timer
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_TIMER_WHEEL_H
+#define BSP_TIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Timer.h"
+
+#ifndef TIMER_WHEEL_SLOT_BITS
+/// \brief Number of bits of the expiry time resolved by a single level.
+#define TIMER_WHEEL_SLOT_BITS 6u
+#endif
+
+#ifndef TIMER_WHEEL_LEVELS
+/// \brief Number of levels, the wheel covers 2^(SLOT_BITS * LEVELS) ticks.
+///        Longer timeouts are parked in the last level until they fit.
+#define TIMER_WHEEL_LEVELS 4u
+#endif
+
+#define TIMER_WHEEL_SLOTS (1u << TIMER_WHEEL_SLOT_BITS)
+
+/// \brief Link of a doubly linked, circular timer list.
+typedef struct Timer_WheelNode
+{
+    struct Timer_WheelNode* next; ///< Next node in the list
+    struct Timer_WheelNode* prev; ///< Previous node in the list
+} Timer_WheelNode;
+
+/// \brief Software timer descriptor, allocated by the user and kept alive
+///        while pending.
+typedef struct
+{
+    Timer_WheelNode node;           ///< Link in a wheel slot, has to be the first member
+    Timer_InterruptHandler handler; ///< Callback run from the tick interrupt on expiry
+    uint32_t expiry;                ///< Wheel time at which the timer expires
+    bool isPending;                 ///< Is timer scheduled and not yet dispatched
+} Timer_WheelTimer;
+
+/// \brief Timing wheel descriptor.
+typedef struct
+{
+    Timer_WheelNode slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS]; ///< Pending timers by level and slot
+    Timer_WheelNode expired;                                      ///< Timers due in the current tick
+    volatile uint32_t time;                                       ///< Number of ticks elapsed
+    RTEMS_INTERRUPT_LOCK_MEMBER(lock)
+} Timer_Wheel;
+
+/// \brief Initializes an empty wheel at time 0.
+/// \param [out] wheel Wheel descriptor.
+void Timer_Wheel_init(Timer_Wheel* const wheel);
+
+/// \brief Initializes an Apbctrl1 timer generating a periodic interrupt
+///        that advances the wheel by one tick, and starts it.
+/// \param [in] wheel Wheel descriptor.
+/// \param [in] id Timer device identifier.
+/// \param [out] timer Timer device descriptor, kept alive while in use.
+/// \param [in] tickPeriod Wheel tick period in ticks of the timer, set by
+///             its base scaler.
+void Timer_Wheel_startApbctrl1(Timer_Wheel* const wheel,
+                               const Timer_Id id,
+                               Timer_Apbctrl1* const timer,
+                               const uint32_t tickPeriod);
+
+/// \brief Initializes an idle software timer.
+/// \param [out] timer Software timer descriptor.
+/// \param [in] handler Callback and its argument run on expiry.
+void Timer_Wheel_initTimer(Timer_WheelTimer* const timer, const Timer_InterruptHandler handler);
+
+/// \brief Schedules a timer in constant time, rescheduling it if pending.
+///        Can be called from the timer callbacks, e.g. to make them periodic.
+/// \param [in] wheel Wheel descriptor.
+/// \param [in] timer Software timer descriptor.
+/// \param [in] timeout Number of wheel ticks after which the timer expires,
+///             at least 1.
+void Timer_Wheel_schedule(Timer_Wheel* const wheel, Timer_WheelTimer* const timer, const uint32_t timeout);
+
+/// \brief Cancels a timer in constant time.
+/// \param [in] wheel Wheel descriptor.
+/// \param [in] timer Software timer descriptor.
+/// \returns Whether the timer was pending.
+bool Timer_Wheel_cancel(Timer_Wheel* const wheel, Timer_WheelTimer* const timer);
+
+/// \brief Checks whether a timer is scheduled and its callback did not run yet.
+/// \param [in] timer Software timer descriptor.
+/// \returns Whether the timer is pending.
+bool Timer_Wheel_isPending(const Timer_WheelTimer* const timer);
+
+/// \brief Advances the wheel by one tick and runs callbacks of all timers
+///        expiring in it. Called from the tick interrupt.
+/// \param [in] wheel Wheel descriptor.
+/// \returns Number of dispatched callbacks.
+uint32_t Timer_Wheel_tick(Timer_Wheel* const wheel);
+
+/// \brief Gets the number of ticks elapsed since Timer_Wheel_init.
+/// \param [in] wheel Wheel descriptor.
+/// \returns Wheel time.
+uint32_t Timer_Wheel_getTime(const Timer_Wheel* const wheel);
+
+#endif // BSP_TIMER_WHEEL_H
+
+/** @} */
@@ -23,6 +23,7 @@
  */
 
 #include "Timer_private.h"
+#include "Trace.h"
 
 void
 Timer_baseInit(volatile uint32_t *const baseConfigurationRegister)
@@ -99,7 +100,9 @@ irqDeinit(rtems_interrupt_entry *entry, const uint8_t irqNumber)
 
 void Timer_handleIrq(Timer_InterruptHandler* const handler)
 {
+    TRACE_RECORD(Trace_Event_TimerInterruptEntry, 0, 0, (uint32_t)(uintptr_t)handler);
     handler->callback(handler->arg);
+    TRACE_RECORD(Trace_Event_TimerInterruptExit, 0, 0, (uint32_t)(uintptr_t)handler);
 }
 
 bool
@@ -0,0 +1,135 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Trace.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if (TRACE_RING_SIZE == 0) || ((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) != 0)
+#error "TRACE_RING_SIZE has to be a power of two"
+#endif
+
+#define TRACE_RING_MASK (TRACE_RING_SIZE - 1u)
+
+#define TRACE_LINE_LENGTH 48u
+
+static Trace_Entry ring[TRACE_RING_SIZE];
+static uint32_t head;
+static const volatile uint32_t* timestampCounter;
+static uint32_t timestampStart;
+static volatile bool isRecordingEnabled;
+
+static inline uint32_t
+getTimestamp(void)
+{
+    if (timestampCounter == NULL) {
+        return 0;
+    }
+    // GPTIMER counts down, so elapsed ticks grow as the counter decreases
+    return timestampStart - *timestampCounter;
+}
+
+static inline uint32_t
+getStoredCount(const uint32_t recorded)
+{
+    return recorded < TRACE_RING_SIZE ? recorded : TRACE_RING_SIZE;
+}
+
+void
+Trace_init(const volatile uint32_t* const counterRegister)
+{
+    isRecordingEnabled = false;
+    memset(ring, 0, sizeof(ring));
+    timestampCounter = counterRegister;
+    timestampStart = counterRegister != NULL ? *counterRegister : 0;
+    __atomic_store_n(&head, 0, __ATOMIC_RELAXED);
+    isRecordingEnabled = true;
+}
+
+void
+Trace_setEnabled(const bool isEnabled)
+{
+    isRecordingEnabled = isEnabled;
+}
+
+void
+Trace_record(const Trace_Event event, const uint8_t source, const uint16_t count, const uint32_t value)
+{
+    if (!isRecordingEnabled) {
+        return;
+    }
+
+    const uint32_t index = __atomic_fetch_add(&head, 1u, __ATOMIC_RELAXED);
+    Trace_Entry* const entry = &ring[index & TRACE_RING_MASK];
+    entry->timestamp = getTimestamp();
+    entry->event = (uint8_t)event;
+    entry->source = source;
+    entry->count = count;
+    entry->value = value;
+}
+
+uint32_t
+Trace_snapshot(Trace_Entry* const entries, const uint32_t capacity)
+{
+    const uint32_t recorded = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    const uint32_t stored = getStoredCount(recorded);
+    const uint32_t count = stored < capacity ? stored : capacity;
+    const uint32_t first = recorded - count;
+
+    for (uint32_t i = 0; i < count; i++) {
+        entries[i] = ring[(first + i) & TRACE_RING_MASK];
+    }
+
+    return count;
+}
+
+uint32_t
+Trace_getRecordedCount(void)
+{
+    return __atomic_load_n(&head, __ATOMIC_RELAXED);
+}
+
+void
+Trace_dump(const Trace_Output output, void* const arg)
+{
+    const uint32_t recorded = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    const uint32_t count = getStoredCount(recorded);
+    char line[TRACE_LINE_LENGTH];
+
+    for (uint32_t i = recorded - count; i != recorded; i++) {
+        const Trace_Entry* const entry = &ring[i & TRACE_RING_MASK];
+        snprintf(line,
+                 sizeof(line),
+                 "%" PRIu32 ",%u,%u,%u,0x%08" PRIx32 "\n",
+                 entry->timestamp,
+                 (unsigned)entry->event,
+                 (unsigned)entry->source,
+                 (unsigned)entry->count,
+                 entry->value);
+        output(arg, line);
+    }
+}
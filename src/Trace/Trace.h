@@ -0,0 +1,122 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Fixed-size binary event ring recording interrupt handler activity
+///        for post-mortem analysis.
+///
+/// Tracing is enabled at compile time by building the drivers with
+/// TRACE_ENABLED (e.g. make uart DEFS=-DTRACE_ENABLED) and linking libtrace.
+/// Without it the TRACE_RECORD macro used by the drivers expands to nothing
+/// and the module does not need to be linked.
+
+/**
+ * @defgroup Trace Trace
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_TRACE_H
+#define BSP_TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef TRACE_RING_SIZE
+/// \brief Number of entries kept in the ring, has to be a power of two.
+#define TRACE_RING_SIZE 256u
+#endif
+
+/// \brief Traced events. Uart events carry the Uart_Id as source and the
+///        status register as value, exit events also the number of bytes
+///        transferred by the handler. Timer events carry the address of the
+///        interrupt handler descriptor as value.
+typedef enum
+{
+    Trace_Event_UartInterruptEntry = 0,  ///< Uart_handleInterrupt entered
+    Trace_Event_UartInterruptExit = 1,   ///< Uart_handleInterrupt left
+    Trace_Event_TimerInterruptEntry = 2, ///< Timer_handleIrq entered
+    Trace_Event_TimerInterruptExit = 3,  ///< Timer_handleIrq left
+    Trace_Event_User = 16,               ///< First event free for application use
+} Trace_Event;
+
+/// \brief Single trace ring entry.
+typedef struct
+{
+    uint32_t timestamp; ///< Timer ticks elapsed since Trace_init
+    uint8_t event;      ///< Trace_Event value
+    uint8_t source;     ///< Device identifier
+    uint16_t count;     ///< Number of bytes transferred or other count
+    uint32_t value;     ///< Status register or other event specific value
+} Trace_Entry;
+
+/// \brief Function writing a formatted line during Trace_dump.
+typedef void (*Trace_Output)(void* arg, const char* line);
+
+/// \brief Starts recording into a cleared ring.
+/// \param [in] counterRegister Counter register of a free-running GPTIMER,
+///             e.g. timer->regs->counter of a Timer_Apbctrl1 started with
+///             auto reload of 0xFFFFFFFF. Timestamps are taken as the number
+///             of ticks the counter has decremented since this call.
+void Trace_init(const volatile uint32_t* const counterRegister);
+
+/// \brief Enables or disables recording, e.g. to freeze the ring when a
+///        failure is detected.
+/// \param [in] isEnabled Whether new events should be recorded.
+void Trace_setEnabled(const bool isEnabled);
+
+/// \brief Records an event. Safe to call from interrupt handlers on any
+///        processor.
+/// \param [in] event Event identifier.
+/// \param [in] source Device identifier.
+/// \param [in] count Number of bytes transferred or other count.
+/// \param [in] value Status register or other event specific value.
+void Trace_record(const Trace_Event event, const uint8_t source, const uint16_t count, const uint32_t value);
+
+/// \brief Copies recorded entries, oldest first.
+/// \param [out] entries Destination buffer.
+/// \param [in] capacity Number of entries that fit in the destination buffer.
+/// \returns Number of copied entries, the newest ones if the buffer is short.
+uint32_t Trace_snapshot(Trace_Entry* const entries, const uint32_t capacity);
+
+/// \brief Gets total number of events recorded since Trace_init, including
+///        the ones already overwritten.
+/// \returns Number of recorded events.
+uint32_t Trace_getRecordedCount(void);
+
+/// \brief Formats recorded entries, oldest first, as comma separated lines of
+///        timestamp, event, source, count and hexadecimal value. Recording
+///        should be disabled during the dump.
+/// \param [in] output Function receiving each line.
+/// \param [in] arg Argument passed to the output function.
+void Trace_dump(const Trace_Output output, void* const arg);
+
+#ifdef TRACE_ENABLED
+#define TRACE_RECORD(event, source, count, value) Trace_record((event), (source), (count), (value))
+#else
+#define TRACE_RECORD(event, source, count, value) ((void)0)
+#endif
+
+#endif // BSP_TRACE_H
+
+/** @} */
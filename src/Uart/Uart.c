@@ -27,11 +27,34 @@
 #include <stdbool.h>
 #include "Uart.h"
 #include "UartRegisters.h"
-#include "ByteFifo.h"
+#include "UartFifo.h"
+#include "Trace.h"
+#include "Crc.h"
 #include <rtems.h>
 
+#ifdef MOCK_REGISTERS
+#include <stdlib.h>
+
+Uart_MockRegisterHooks Uart_mockRegisterHooks = { .readData = NULL,
+                                                  .writeData = NULL };
+#endif
+
 #define GPTIMER_ADDRESS_BASE 0x80000300U
 
+#ifdef UART_STATIC_PORTS
+// Interrupt path helpers are inlined into each per-port handler, so that
+// register accesses are folded into the constant base address of the port
+#define UART_INTERRUPT_PATH static inline __attribute__((always_inline))
+#else
+#define UART_INTERRUPT_PATH static inline
+#endif
+
+#ifdef MOCK_REGISTERS
+#define UART_PORT_REGISTERS(uart, port) ((uart)->reg)
+#else
+#define UART_PORT_REGISTERS(uart, port) ((UartRegisters_t)Uart##port##_address)
+#endif
+
 static inline UartRegisters_t
 getAddressBase(Uart_Id id)
 {
@@ -53,154 +76,1256 @@ getAddressBase(Uart_Id id)
     }
 }
 
+static inline uint64_t
+getBaudRateDeviation(const uint32_t clockFrequency, const uint32_t baudRate, const uint32_t divisor)
+{
+    // Deviation of the generated rate scaled by 8 * divisor
+    const uint64_t target = (uint64_t)UART_CLKSCL_DIV * divisor * baudRate;
+    return target > clockFrequency ? target - clockFrequency : clockFrequency - target;
+}
+
+static inline uint32_t
+getAchievedBaudRate(const uint32_t clockFrequency, const uint32_t scaler)
+{
+    const uint64_t divider = (uint64_t)UART_CLKSCL_DIV * (scaler + 1u);
+    return (uint32_t)((clockFrequency + divider / 2u) / divider);
+}
+
+static inline void
+completeBaudRateSetting(const uint32_t clockFrequency, const uint32_t baudRate, Uart_BaudRateSetting* const setting)
+{
+    setting->achievedBaudRate = getAchievedBaudRate(clockFrequency, setting->scaler);
+    const int64_t deviation = ((int64_t)setting->achievedBaudRate - (int64_t)baudRate) * 10000;
+    const int64_t rounding = deviation < 0 ? -(int64_t)(baudRate / 2u) : (int64_t)(baudRate / 2u);
+    setting->errorBasisPoints = (int32_t)((deviation + rounding) / (int64_t)baudRate);
+}
+
+static inline Uart_interrupt
+interruptNumber(Uart_Id id)
+{
+    switch(id) {
+        case Uart_Id_0:
+            return Uart0_interrupt;
+        case Uart_Id_1:
+            return Uart1_interrupt;
+        case Uart_Id_2:
+            return Uart2_interrupt;
+        case Uart_Id_3:
+            return Uart3_interrupt;
+        case Uart_Id_4:
+            return Uart4_interrupt;
+        case Uart_Id_5:
+            return Uart5_interrupt;
+        default:
+            return UartInvalid_interrupt;
+    }
+}
+
+UART_INTERRUPT_PATH uint8_t
+readData(Uart* const uart, const UartRegisters_t reg)
+{
+#ifdef MOCK_REGISTERS
+    if (Uart_mockRegisterHooks.readData != NULL) {
+        return Uart_mockRegisterHooks.readData(uart);
+    }
+#else
+    (void)uart;
+#endif
+    return (uint8_t)reg->data;
+}
+
+UART_INTERRUPT_PATH void
+writeData(Uart* const uart, const UartRegisters_t reg, const uint8_t data)
+{
+#ifdef MOCK_REGISTERS
+    if (Uart_mockRegisterHooks.writeData != NULL) {
+        Uart_mockRegisterHooks.writeData(uart, data);
+        return;
+    }
+#else
+    (void)uart;
+#endif
+    reg->data = data;
+}
+
+UART_INTERRUPT_PATH void
+transmitByte(Uart* const uart, const UartRegisters_t reg, const uint8_t byte)
+{
+    writeData(uart, reg, byte);
+    uart->statistics.counters.txBytes++;
+}
+
+static inline void
+updatePeak(uint32_t* const peak, const uint32_t value)
+{
+    if (value > *peak) {
+        *peak = value;
+    }
+}
+
+static inline void
+beginStatisticsUpdate(Uart* const uart)
+{
+    Uart_StatisticsData* const statistics = &uart->statistics;
+    __atomic_store_n(&statistics->sequence, statistics->sequence + 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    const uint32_t peakResetRequest = __atomic_load_n(&statistics->peakResetRequest, __ATOMIC_ACQUIRE);
+    if (peakResetRequest != statistics->peakResetAck) {
+        statistics->counters.rxQueuePeak = 0;
+        statistics->counters.hardwareRxFifoPeak = 0;
+        statistics->peakResetAck = peakResetRequest;
+    }
+}
+
+static inline void
+endStatisticsUpdate(Uart* const uart)
+{
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&uart->statistics.sequence, uart->statistics.sequence + 1u, __ATOMIC_RELAXED);
+}
+
 static inline uint32_t
-baudRateToValue(const Uart_BaudRate baud)
-{
-    switch(baud) {
-        case Uart_BaudRate_300:
-        case Uart_BaudRate_600:
-        case Uart_BaudRate_1200:
-        case Uart_BaudRate_1800:
-        case Uart_BaudRate_2400:
-        case Uart_BaudRate_4800:
-        case Uart_BaudRate_9600:
-        case Uart_BaudRate_19200:
-        case Uart_BaudRate_28800:
-        case Uart_BaudRate_38400:
-        case Uart_BaudRate_57600:
-        case Uart_BaudRate_76800:
-        case Uart_BaudRate_115200:
-            return (uint32_t) baud;
+getTransferredBytes(const Uart* const uart)
+{
+    return uart->statistics.counters.txBytes + uart->statistics.counters.rxBytes;
+}
+
+static inline void
+readStatistics(const Uart* const uart, Uart_Statistics* const counters, bool* const isPeakResetPending)
+{
+    const Uart_StatisticsData* const statistics = &uart->statistics;
+    uint32_t sequence = 0;
+
+    do {
+        sequence = __atomic_load_n(&statistics->sequence, __ATOMIC_ACQUIRE);
+        *counters = statistics->counters;
+        *isPeakResetPending = statistics->peakResetRequest != statistics->peakResetAck;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while ((sequence & 1u) != 0 || sequence != __atomic_load_n(&statistics->sequence, __ATOMIC_RELAXED));
+}
+
+static inline uint32_t
+getInitialChecksum(const Uart_ChecksumType type)
+{
+    switch (type) {
+        case Uart_ChecksumType_Crc16:
+            return CRC16_INITIAL_VALUE;
+        case Uart_ChecksumType_Crc32:
+            return CRC32_INITIAL_VALUE;
         default:
             return 0;
     }
 }
 
-static inline Uart_BaudRate
-valueToBaudRate(const uint32_t value)
-{
-    switch(value) {
-        case 300:
-        case 600:
-        case 1200:
-        case 1800:
-        case 2400:
-        case 4800:
-        case 9600:
-        case 19200:
-        case 28800:
-        case 38400:
-        case 57600:
-        case 76800:
-        case 115200:
-            return (Uart_BaudRate) value;
-            break;
-        default:
-            return Uart_BaudRate_Invalid;
+static inline uint32_t
+updateChecksum(const Uart_ChecksumType type, const uint32_t crc, const uint8_t byte)
+{
+    switch (type) {
+        case Uart_ChecksumType_Crc16:
+            return Crc16_updateByte((uint16_t)crc, byte);
+        case Uart_ChecksumType_Crc32:
+            return Crc32_updateByte(crc, byte);
+        default:
+            return crc;
+    }
+}
+
+static inline uint32_t
+finalizeChecksum(const Uart_ChecksumType type, const uint32_t crc)
+{
+    return type == Uart_ChecksumType_Crc32 ? Crc32_finalize(crc) : crc;
+}
+
+static inline void
+restartRxChecksum(Uart* const uart)
+{
+    uart->checksums.rx = getInitialChecksum(uart->checksums.type);
+}
+
+static inline void
+restartTxChecksum(Uart* const uart)
+{
+    uart->checksums.tx = getInitialChecksum(uart->checksums.type);
+}
+
+static inline void
+accountRxByte(Uart* const uart, const uint8_t byte)
+{
+    if (uart->checksums.type != Uart_ChecksumType_None) {
+        uart->checksums.rx = updateChecksum(uart->checksums.type, uart->checksums.rx, byte);
+    }
+}
+
+static inline void
+accountTxByte(Uart* const uart, const uint8_t byte)
+{
+    if (uart->checksums.type != Uart_ChecksumType_None) {
+        uart->checksums.tx = updateChecksum(uart->checksums.type, uart->checksums.tx, byte);
+    }
+}
+
+static inline uint32_t
+endRxChecksumBlock(Uart* const uart)
+{
+    const uint32_t checksum = finalizeChecksum(uart->checksums.type, uart->checksums.rx);
+    restartRxChecksum(uart);
+    return checksum;
+}
+
+UART_INTERRUPT_PATH void
+setControlFlag(Uart* const uart, const UartRegisters_t reg, const bool isSet, const uint32_t flag)
+{
+    Uart_setFlag(&uart->control, isSet, flag);
+    reg->control = uart->control;
+}
+
+static inline bool
+isControlFlagSet(const Uart* const uart, const uint32_t flag)
+{
+    return Uart_getFlag(uart->control, flag);
+}
+
+static inline void
+lockDevice(const Uart* const uart, rtems_interrupt_lock_context* const context)
+{
+    rtems_interrupt_lock_acquire((rtems_interrupt_lock*)&uart->lock, context);
+}
+
+static inline void
+unlockDevice(const Uart* const uart, rtems_interrupt_lock_context* const context)
+{
+    rtems_interrupt_lock_release((rtems_interrupt_lock*)&uart->lock, context);
+}
+
+static inline void
+lockFifo(const Uart* const uart, rtems_interrupt_lock_context* const context)
+{
+#if !UART_FIFO_IS_LOCK_FREE
+    lockDevice(uart, context);
+#else
+    (void)uart;
+    (void)context;
+#endif
+}
+
+static inline void
+unlockFifo(const Uart* const uart, rtems_interrupt_lock_context* const context)
+{
+#if !UART_FIFO_IS_LOCK_FREE
+    unlockDevice(uart, context);
+#else
+    (void)uart;
+    (void)context;
+#endif
+}
+
+static inline void
+emptyCallback(volatile void* arg)
+{
+    (void)arg;
+}
+
+static Uart_TxHandler defaultTxHandler = { .callback = emptyCallback,
+                                           .arg = 0 };
+
+static Uart_RxHandler defaultRxHandler = { .lengthCallback = emptyCallback,
+                                           .characterCallback = emptyCallback,
+                                           .lengthArg = 0,
+                                           .characterArg = 0,
+                                           .targetCharacter = '\0',
+                                           .targetLength = 0 };
+
+static Uart_ErrorHandler defaultErrorHandler = { .callback = emptyCallback,
+                                                 .arg = 0 };
+
+#ifndef UART_CALLBACK_BATCH_SIZE
+/// \brief Number of buffer hand-overs and descriptor completions collected in
+///        one locked section, further transfers wait for the next section.
+#define UART_CALLBACK_BATCH_SIZE 8u
+#endif
+
+/// \brief Callbacks collected while the descriptor lock is held and called
+///        after it is released, so that a callback may call back into the
+///        driver, e.g. to start the next transfer.
+typedef struct
+{
+    bool isError;                                     ///< Error detected
+    Uart_ErrorHandler errorHandler;                   ///< Error handler
+    uint32_t characterMatches;                        ///< Target characters received
+    uint32_t lengthMatches;                           ///< Target lengths reached
+    Uart_RxHandler rxHandler;                         ///< Reception handler
+    uint32_t burstCount;                              ///< Bursts ended
+    uint32_t burstLength;                             ///< Length of each ended burst
+    UartRxBurstCallback burstCallback;                ///< Burst callback
+    volatile void* burstArg;                          ///< Burst callback argument
+    uint32_t burstChecksums[UART_CALLBACK_BATCH_SIZE]; ///< Checksums of ended bursts
+    uint32_t bufferCount;                             ///< Buffers handed over
+    Uart_RxBufferHandler bufferHandler;               ///< Buffer hand-over handler
+    uint8_t* buffers[UART_CALLBACK_BATCH_SIZE];       ///< Handed over buffers
+    uint32_t bufferLengths[UART_CALLBACK_BATCH_SIZE]; ///< Handed over lengths
+    uint32_t bufferChecksums[UART_CALLBACK_BATCH_SIZE]; ///< Their checksums
+    uint32_t descriptorCount;                         ///< Descriptors completed
+    Uart_TxHandler descriptorHandlers[UART_CALLBACK_BATCH_SIZE]; ///< Their handlers
+    uint32_t descriptorChecksums[UART_CALLBACK_BATCH_SIZE]; ///< Their checksums
+    bool isTxComplete;                                ///< Transmission completed
+    Uart_TxHandler txHandler;                         ///< End-of-transmission handler
+    uint32_t txChecksum;                              ///< Checksum of the transmission
+    bool isTruncated;                                 ///< Stopped early on a full batch
+} PendingCallbacks;
+
+static inline void
+initCallbacks(PendingCallbacks* const callbacks)
+{
+    callbacks->isError = false;
+    callbacks->characterMatches = 0;
+    callbacks->lengthMatches = 0;
+    callbacks->burstCount = 0;
+    callbacks->bufferCount = 0;
+    callbacks->descriptorCount = 0;
+    callbacks->isTxComplete = false;
+    callbacks->isTruncated = false;
+}
+
+static inline void
+notifyTxComplete(Uart* const uart, PendingCallbacks* const callbacks)
+{
+    callbacks->isTxComplete = true;
+    callbacks->txHandler = uart->txHandler;
+    callbacks->txChecksum = finalizeChecksum(uart->checksums.type, uart->checksums.tx);
+}
+
+static inline void
+publishRxChecksum(Uart* const uart, const uint32_t checksum)
+{
+    __atomic_store_n(&uart->checksums.lastRx, checksum, __ATOMIC_RELAXED);
+}
+
+static inline void
+publishTxChecksum(Uart* const uart, const uint32_t checksum)
+{
+    __atomic_store_n(&uart->checksums.lastTx, checksum, __ATOMIC_RELAXED);
+}
+
+// Each completion carries its own checksum, as several of them may be
+// collected in one section before any callback is called
+static void
+callPendingCallbacks(Uart* const uart, const PendingCallbacks* const callbacks)
+{
+    if (callbacks->isError) {
+        callbacks->errorHandler.callback(callbacks->errorHandler.arg);
+    }
+    for (uint32_t i = 0; i < callbacks->characterMatches; i++) {
+        callbacks->rxHandler.characterCallback(callbacks->rxHandler.characterArg);
+    }
+    for (uint32_t i = 0; i < callbacks->lengthMatches; i++) {
+        callbacks->rxHandler.lengthCallback(callbacks->rxHandler.lengthArg);
+    }
+    // All bursts ended in one section are threshold long, idle timeouts are
+    // handled in sections of their own
+    for (uint32_t i = 0; i < callbacks->burstCount; i++) {
+        publishRxChecksum(uart, callbacks->burstChecksums[i]);
+        callbacks->burstCallback(callbacks->burstArg, callbacks->burstLength);
+    }
+    for (uint32_t i = 0; i < callbacks->bufferCount; i++) {
+        publishRxChecksum(uart, callbacks->bufferChecksums[i]);
+        callbacks->bufferHandler.callback(callbacks->bufferHandler.arg,
+                                          callbacks->buffers[i],
+                                          callbacks->bufferLengths[i]);
+    }
+    for (uint32_t i = 0; i < callbacks->descriptorCount; i++) {
+        publishTxChecksum(uart, callbacks->descriptorChecksums[i]);
+        callbacks->descriptorHandlers[i].callback(callbacks->descriptorHandlers[i].arg);
+    }
+    if (callbacks->isTxComplete) {
+        publishTxChecksum(uart, callbacks->txChecksum);
+        callbacks->txHandler.callback(callbacks->txHandler.arg);
+    }
+}
+
+static inline bool
+isRxSinkSet(const Uart* const uart)
+{
+    return uart->rxFifo != NULL || uart->rxBuffers.memoryBlock != NULL;
+}
+
+static inline bool
+isTxSourceEmpty(const Uart* const uart)
+{
+    if (uart->txVector.buffers != NULL) {
+        return uart->txVector.index >= uart->txVector.count;
+    }
+    if (uart->txQueue.descriptors != NULL) {
+        return uart->txQueue.completedCount == uart->txQueue.submittedCount;
+    }
+    return uart->txFifo == NULL || Uart_Fifo_isEmpty(uart->txFifo);
+}
+
+static inline void
+updateRxFlowControl(Uart* const uart)
+{
+    Uart_FlowControl* const flowControl = &uart->flowControl;
+    if (!flowControl->isEnabled || uart->rxFifo == NULL) {
+        return;
+    }
+
+    const uint32_t count = Uart_Fifo_getCount(uart->rxFifo);
+    if (!flowControl->isRxPaused && count >= flowControl->highWaterMark) {
+        flowControl->isRxPaused = true;
+        flowControl->pendingByte = UART_XOFF;
+    } else if (flowControl->isRxPaused && count <= flowControl->lowWaterMark) {
+        flowControl->isRxPaused = false;
+        flowControl->pendingByte = UART_XON;
+    }
+}
+
+static inline void
+resumeTx(Uart* const uart)
+{
+    uart->flowControl.isTxPaused = false;
+    if (uart->isTxBulkModeEnabled && !isTxSourceEmpty(uart)) {
+        uart->flowControl.isSendingControlOnly = false;
+        setControlFlag(uart, uart->reg, UART_FLAG_SET, UART_CONTROL_TF);
+    }
+}
+
+static inline bool
+receiveFlowControlByte(Uart* const uart, const uint8_t buf)
+{
+    if (!uart->flowControl.isEnabled || (buf != UART_XON && buf != UART_XOFF)) {
+        return false;
+    }
+
+    if (buf == UART_XOFF) {
+        uart->flowControl.isTxPaused = true;
+    } else if (uart->flowControl.isTxPaused) {
+        resumeTx(uart);
+    }
+    return true;
+}
+
+static inline void
+handOverRxBuffer(Uart* const uart, PendingCallbacks* const callbacks)
+{
+    Uart_RxBuffers* const rxBuffers = &uart->rxBuffers;
+    const uint32_t filledCount = rxBuffers->filledCount;
+    uint8_t* const buffer = rxBuffers->memoryBlock + (filledCount % rxBuffers->bufferCount) * rxBuffers->bufferSize;
+    const uint32_t length = rxBuffers->offset;
+
+    rxBuffers->offset = 0;
+    callbacks->bufferChecksums[callbacks->bufferCount] = endRxChecksumBlock(uart);
+    __atomic_store_n(&rxBuffers->filledCount, filledCount + 1u, __ATOMIC_RELEASE);
+    callbacks->bufferHandler = rxBuffers->handler;
+    callbacks->buffers[callbacks->bufferCount] = buffer;
+    callbacks->bufferLengths[callbacks->bufferCount] = length;
+    callbacks->bufferCount++;
+    if (rxBuffers->isOneShot) {
+        *rxBuffers = (Uart_RxBuffers){0};
+    }
+}
+
+static inline void
+setRxBuffers(Uart* const uart,
+             uint8_t* const memoryBlock,
+             const uint32_t bufferSize,
+             const uint32_t bufferCount,
+             const Uart_RxBufferHandler handler,
+             const bool isFramed)
+{
+    uart->rxFifo = NULL;
+    uart->rxCoalescing = (Uart_RxCoalescing){0};
+    uart->rxFraming = (Uart_RxFraming){ .isEnabled = isFramed, .isDiscarding = false };
+    restartRxChecksum(uart);
+    uart->rxBuffers = (Uart_RxBuffers){ .memoryBlock = memoryBlock,
+                                        .bufferSize = bufferSize,
+                                        .bufferCount = bufferCount,
+                                        .offset = 0,
+                                        .filledCount = 0,
+                                        .releasedCount = 0,
+                                        .handler = handler };
+}
+
+static inline void
+startBufferedRx(Uart* const uart,
+                uint8_t* const memoryBlock,
+                const uint32_t bufferSize,
+                const uint32_t bufferCount,
+                const Uart_RxBufferHandler handler,
+                const bool isFramed)
+{
+    rtems_interrupt_lock_context lockContext;
+    if (bufferSize == 0 || bufferCount == 0) {
+        return;
+    }
+
+    lockDevice(uart, &lockContext);
+    setRxBuffers(uart, memoryBlock, bufferSize, bufferCount, handler, isFramed);
+    unlockDevice(uart, &lockContext);
+}
+
+static inline bool
+storeBufferedByte(Uart* const uart, const uint8_t buf)
+{
+    Uart_RxBuffers* const rxBuffers = &uart->rxBuffers;
+    const uint32_t filledCount = rxBuffers->filledCount;
+    const uint32_t releasedCount = __atomic_load_n(&rxBuffers->releasedCount, __ATOMIC_ACQUIRE);
+
+    if (filledCount - releasedCount >= rxBuffers->bufferCount) {
+        uart->errorFlags.hasRxFifoFullErrorOccurred = true;
+        uart->statistics.counters.rxDrops++;
+        return false;
+    }
+
+    rxBuffers->memoryBlock[(filledCount % rxBuffers->bufferCount) * rxBuffers->bufferSize + rxBuffers->offset] = buf;
+    rxBuffers->offset++;
+    accountRxByte(uart, buf);
+    updatePeak(&uart->statistics.counters.rxQueuePeak,
+               (filledCount - releasedCount) * rxBuffers->bufferSize + rxBuffers->offset);
+    return true;
+}
+
+static inline void
+receiveBufferedByte(Uart* const uart, const uint8_t buf, PendingCallbacks* const callbacks)
+{
+    if (storeBufferedByte(uart, buf) && uart->rxBuffers.offset == uart->rxBuffers.bufferSize) {
+        handOverRxBuffer(uart, callbacks);
+    }
+}
+
+static inline void
+discardRxFrame(Uart* const uart)
+{
+    uart->rxFraming.isDiscarding = true;
+    uart->rxBuffers.offset = 0;
+    restartRxChecksum(uart);
+}
+
+static inline void
+receiveFramedByte(Uart* const uart, const uint8_t buf, PendingCallbacks* const callbacks)
+{
+    Uart_RxFraming* const framing = &uart->rxFraming;
+    Uart_RxBuffers* const rxBuffers = &uart->rxBuffers;
+    uint8_t payload = 0;
+
+    switch (SlipDecoder_decode(&framing->decoder, buf, &payload)) {
+        case SlipDecoder_Result_FrameEnd:
+            if (!framing->isDiscarding && rxBuffers->offset > 0) {
+                handOverRxBuffer(uart, callbacks);
+            }
+            framing->isDiscarding = false;
+            rxBuffers->offset = 0;
+            break;
+        case SlipDecoder_Result_Error:
+            if (!framing->isDiscarding) {
+                uart->statistics.counters.rxFrameErrors++;
+                discardRxFrame(uart);
+            }
+            break;
+        case SlipDecoder_Result_Byte:
+            if (framing->isDiscarding) {
+                uart->statistics.counters.rxDrops++;
+            } else if (rxBuffers->offset == rxBuffers->bufferSize) {
+                uart->statistics.counters.rxFrameErrors++;
+                uart->statistics.counters.rxDrops += rxBuffers->offset + 1u;
+                discardRxFrame(uart);
+            } else if (!storeBufferedByte(uart, payload)) {
+                discardRxFrame(uart);
+            }
+            break;
+        case SlipDecoder_Result_None:
+        default:
+            break;
+    }
+}
+
+static inline void
+endRxBurst(Uart* const uart, PendingCallbacks* const callbacks)
+{
+    Uart_RxCoalescing* const coalescing = &uart->rxCoalescing;
+    const uint32_t length = coalescing->pendingBytes;
+
+    if (coalescing->handler.idleTimer.stop != NULL) {
+        coalescing->handler.idleTimer.stop(coalescing->handler.idleTimer.timer);
+    }
+    coalescing->pendingBytes = 0;
+    callbacks->burstChecksums[callbacks->burstCount] = endRxChecksumBlock(uart);
+    callbacks->burstCallback = coalescing->handler.callback;
+    callbacks->burstArg = coalescing->handler.arg;
+    callbacks->burstLength = length;
+    callbacks->burstCount++;
+}
+
+static inline void
+receiveCoalescedByte(Uart* const uart, const uint8_t buf, PendingCallbacks* const callbacks)
+{
+    Uart_RxCoalescing* const coalescing = &uart->rxCoalescing;
+
+    Uart_Fifo_push(uart->rxFifo, buf);
+    accountRxByte(uart, buf);
+    updatePeak(&uart->statistics.counters.rxQueuePeak, Uart_Fifo_getCount(uart->rxFifo));
+    coalescing->pendingBytes++;
+    if (coalescing->handler.threshold != 0 && coalescing->pendingBytes >= coalescing->handler.threshold) {
+        endRxBurst(uart, callbacks);
+    }
+}
+
+static inline void
+restartRxIdleTimer(Uart* const uart)
+{
+    const Uart_RxCoalescing* const coalescing = &uart->rxCoalescing;
+
+    // Restarted once per handled batch rather than per byte
+    if (coalescing->isEnabled && coalescing->pendingBytes > 0 && coalescing->handler.idleTimer.restart != NULL) {
+        coalescing->handler.idleTimer.restart(coalescing->handler.idleTimer.timer, coalescing->handler.idleTimeout);
+    }
+}
+
+static inline void
+receiveByte(Uart* const uart, const uint8_t buf, PendingCallbacks* const callbacks)
+{
+    uart->statistics.counters.rxBytes++;
+
+    if (receiveFlowControlByte(uart, buf)) {
+        return;
+    }
+
+    if (uart->rxBuffers.memoryBlock != NULL) {
+        if (uart->rxFraming.isEnabled) {
+            receiveFramedByte(uart, buf, callbacks);
+        } else {
+            receiveBufferedByte(uart, buf, callbacks);
+        }
+        return;
+    }
+
+    if (Uart_Fifo_isFull(uart->rxFifo)) {
+        uart->errorFlags.hasRxFifoFullErrorOccurred = true;
+        uart->statistics.counters.rxDrops++;
+        return;
+    }
+
+    if (uart->rxCoalescing.isEnabled) {
+        receiveCoalescedByte(uart, buf, callbacks);
+        updateRxFlowControl(uart);
+        return;
+    }
+
+    if (buf == uart->rxHandler.targetCharacter) {
+        callbacks->rxHandler = uart->rxHandler;
+        callbacks->characterMatches++;
+    }
+    uart->interruptData.sentBytes++;
+    if (uart->interruptData.sentBytes == uart->rxHandler.targetLength) {
+        uart->interruptData.sentBytes = 0;
+        callbacks->rxHandler = uart->rxHandler;
+        callbacks->lengthMatches++;
+    }
+    Uart_Fifo_push(uart->rxFifo, buf);
+    accountRxByte(uart, buf);
+    updatePeak(&uart->statistics.counters.rxQueuePeak, Uart_Fifo_getCount(uart->rxFifo));
+    updateRxFlowControl(uart);
+}
+
+static inline void
+discardRxByte(Uart* const uart, const UartRegisters_t reg)
+{
+    // Reading the byte is what clears the Rx interrupt condition
+    (void)readData(uart, reg);
+    uart->statistics.counters.rxBytes++;
+    uart->statistics.counters.rxDrops++;
+}
+
+UART_INTERRUPT_PATH uint32_t
+drainRxFifo(Uart* const uart, const UartRegisters_t reg, PendingCallbacks* const callbacks)
+{
+    if (!isControlFlagSet(uart, UART_CONTROL_RE)) {
+        return 0;
+    }
+
+    const uint32_t status = reg->status;
+    uint32_t count = (status & UART_STATUS_RCNT_MASK) >> UART_STATUS_RCNT_OFFSET;
+    if (count == 0 && Uart_getFlag(status, UART_STATUS_DR)) {
+        count = 1;
+    }
+    updatePeak(&uart->statistics.counters.hardwareRxFifoPeak, count);
+
+    if (!isRxSinkSet(uart)) {
+        for (uint32_t i = 0; i < count; i++) {
+            discardRxByte(uart, reg);
+        }
+        return count;
+    }
+
+    // A byte hands over at most one buffer or ends one burst, the rest of the
+    // frames stay in the hardware FIFO until the collected callbacks are called
+    uint32_t i = 0;
+    for (; i < count && isRxSinkSet(uart) && callbacks->bufferCount < UART_CALLBACK_BATCH_SIZE
+           && callbacks->burstCount < UART_CALLBACK_BATCH_SIZE;
+         i++) {
+        receiveByte(uart, readData(uart, reg), callbacks);
+    }
+    callbacks->isTruncated = i < count;
+    count = i;
+    if (count > 0) {
+        restartRxIdleTimer(uart);
+    }
+
+    return count;
+}
+
+static inline void
+skipSentBuffers(Uart_TxVector* const vector)
+{
+    while (vector->index < vector->count && vector->offset >= vector->buffers[vector->index].length) {
+        vector->index++;
+        vector->offset = 0;
+    }
+}
+
+static inline bool
+pullFramedTxByte(Uart* const uart, uint8_t* const byte)
+{
+    Uart_TxFraming* const framing = &uart->txFraming;
+    Uart_TxVector* const vector = &uart->txVector;
+
+    if (SlipEncoder_pullPending(&framing->encoder, byte)) {
+        return true;
+    }
+    if (vector->index >= vector->count) {
+        return false;
+    }
+    if (!framing->isFrameOpen) {
+        framing->isFrameOpen = true;
+        *byte = SLIP_END;
+        return true;
+    }
+
+    const Uart_Buffer* const frame = &vector->buffers[vector->index];
+    if (vector->offset < frame->length) {
+        accountTxByte(uart, frame->data[vector->offset]);
+        *byte = SlipEncoder_encode(&framing->encoder, frame->data[vector->offset]);
+        vector->offset++;
+        return true;
+    }
+
+    framing->isFrameOpen = false;
+    vector->index++;
+    vector->offset = 0;
+    *byte = SLIP_END;
+    return true;
+}
+
+static inline void
+completeTxDescriptors(Uart* const uart, PendingCallbacks* const callbacks)
+{
+    Uart_TxQueue* const queue = &uart->txQueue;
+    while (queue->completedCount != queue->submittedCount && callbacks->descriptorCount < UART_CALLBACK_BATCH_SIZE) {
+        const Uart_TxDescriptor* const descriptor = &queue->descriptors[queue->completedCount % queue->capacity];
+        if (queue->offset < descriptor->length) {
+            return;
+        }
+        callbacks->descriptorHandlers[callbacks->descriptorCount] = descriptor->handler;
+        callbacks->descriptorChecksums[callbacks->descriptorCount] =
+            finalizeChecksum(uart->checksums.type, uart->checksums.tx);
+        callbacks->descriptorCount++;
+        queue->offset = 0;
+        queue->completedCount++;
+    }
+}
+
+static inline bool
+pullQueuedTxByte(Uart* const uart, uint8_t* const byte, PendingCallbacks* const callbacks)
+{
+    Uart_TxQueue* const queue = &uart->txQueue;
+
+    completeTxDescriptors(uart, callbacks);
+    if (queue->completedCount == queue->submittedCount) {
+        return false;
+    }
+
+    const Uart_TxDescriptor* const descriptor = &queue->descriptors[queue->completedCount % queue->capacity];
+    // Sent descriptor left for the next section when the batch is full
+    if (queue->offset >= descriptor->length) {
+        callbacks->isTruncated = true;
+        return false;
+    }
+    if (queue->offset == 0) {
+        restartTxChecksum(uart);
+    }
+    *byte = descriptor->data[queue->offset];
+    queue->offset++;
+    accountTxByte(uart, *byte);
+    completeTxDescriptors(uart, callbacks);
+    return true;
+}
+
+static inline bool
+pullFlowControlByte(Uart* const uart, uint8_t* const byte)
+{
+    if (uart->flowControl.pendingByte == 0) {
+        return false;
+    }
+    *byte = uart->flowControl.pendingByte;
+    uart->flowControl.pendingByte = 0;
+    return true;
+}
+
+static inline bool
+pullTxByte(Uart* const uart, uint8_t* const byte, PendingCallbacks* const callbacks)
+{
+    if (uart->flowControl.isTxPaused) {
+        return false;
+    }
+    if (uart->txFraming.isEnabled) {
+        return pullFramedTxByte(uart, byte);
+    }
+    if (uart->txVector.buffers != NULL) {
+        Uart_TxVector* const vector = &uart->txVector;
+        if (vector->index >= vector->count) {
+            return false;
+        }
+        *byte = vector->buffers[vector->index].data[vector->offset];
+        vector->offset++;
+        skipSentBuffers(vector);
+        accountTxByte(uart, *byte);
+        return true;
+    }
+    if (uart->txQueue.descriptors != NULL) {
+        return pullQueuedTxByte(uart, byte, callbacks);
+    }
+    if (uart->txFifo == NULL || !Uart_Fifo_pull(uart->txFifo, byte)) {
+        return false;
+    }
+    accountTxByte(uart, *byte);
+    return true;
+}
+
+UART_INTERRUPT_PATH void
+fillTxFifo(Uart* const uart, const UartRegisters_t reg, PendingCallbacks* const callbacks)
+{
+    uint8_t buf = '\0';
+    while (!Uart_getFlag(reg->status, UART_STATUS_TF)
+           && (pullFlowControlByte(uart, &buf) || pullTxByte(uart, &buf, callbacks))) {
+        transmitByte(uart, reg, buf);
+    }
+}
+
+static inline void
+startTx(Uart* const uart, PendingCallbacks* const callbacks)
+{
+    uint8_t byte = '\0';
+    if (uart->isTxBulkModeEnabled) {
+        fillTxFifo(uart, uart->reg, callbacks);
+        uart->flowControl.isSendingControlOnly = false;
+        setControlFlag(uart, uart->reg, UART_FLAG_SET, UART_CONTROL_TF);
+    } else if (Uart_getFlag(uart->reg->status, UART_STATUS_TS) && pullTxByte(uart, &byte, callbacks)) {
+        transmitByte(uart, uart->reg, byte);
+        if (isTxSourceEmpty(uart)) {
+            notifyTxComplete(uart, callbacks);
+        }
+    }
+}
+
+static inline void
+startVectorTx(Uart* const uart, PendingCallbacks* const callbacks)
+{
+    // Without a byte to send no frame transmitted interrupt follows, only the
+    // Tx FIFO interrupt of bulk mode reports an empty source on its own
+    if (!uart->isTxBulkModeEnabled && isTxSourceEmpty(uart)) {
+        notifyTxComplete(uart, callbacks);
+        return;
+    }
+    startTx(uart, callbacks);
+}
+
+static inline void
+setTxVector(Uart* const uart,
+            const Uart_Buffer* const buffers,
+            const uint32_t count,
+            const Uart_TxHandler handler,
+            const bool isFramed)
+{
+    uart->txFifo = NULL;
+    uart->txVector = (Uart_TxVector){ .buffers = buffers, .count = count, .index = 0, .offset = 0 };
+    uart->txQueue = (Uart_TxQueue){0};
+    uart->txFraming = (Uart_TxFraming){ .isEnabled = isFramed, .isFrameOpen = false };
+    restartTxChecksum(uart);
+    if (!isFramed) {
+        skipSentBuffers(&uart->txVector);
+    }
+    uart->txHandler = handler;
+}
+
+static inline bool
+isTxBusy(const Uart* const uart)
+{
+    // A descriptor queue stays attached to its client between submissions
+    return uart->txQueue.descriptors != NULL || !isTxSourceEmpty(uart);
+}
+
+static inline void
+startFlowControlTx(Uart* const uart)
+{
+    uint8_t byte = '\0';
+    if (uart->flowControl.pendingByte == 0) {
+        return;
+    }
+    if (uart->isTxBulkModeEnabled) {
+        if (!isControlFlagSet(uart, UART_CONTROL_TF)) {
+            uart->flowControl.isSendingControlOnly = true;
+            setControlFlag(uart, uart->reg, UART_FLAG_SET, UART_CONTROL_TF);
+        }
+    } else if (Uart_getFlag(uart->reg->status, UART_STATUS_TS) && pullFlowControlByte(uart, &byte)) {
+        transmitByte(uart, uart->reg, byte);
+    }
+}
+
+static inline void
+rearmTx(Uart* const uart, PendingCallbacks* const callbacks)
+{
+    if (!isControlFlagSet(uart, UART_CONTROL_TE)) {
+        return;
+    }
+    if (!isTxSourceEmpty(uart) && !uart->flowControl.isTxPaused) {
+        startTx(uart, callbacks);
+    }
+    startFlowControlTx(uart);
+}
+
+static void
+notifyTxTask(volatile void* arg)
+{
+    const Uart* const uart = (const Uart*)arg;
+    rtems_event_send(uart->interruptData.txTaskId, UART_TX_EVENT);
+}
+
+static void
+notifyRxTask(volatile void* arg, uint8_t* buffer, uint32_t length)
+{
+    (void)buffer;
+    (void)length;
+    const Uart* const uart = (const Uart*)arg;
+    rtems_event_send(uart->interruptData.rxTaskId, UART_RX_EVENT);
+}
+
+static inline bool
+waitForEvent(const rtems_event_set event, const rtems_interval timeout)
+{
+    rtems_event_set received = 0;
+    return rtems_event_receive(event, RTEMS_WAIT | RTEMS_EVENT_ALL, timeout, &received) == RTEMS_SUCCESSFUL;
+}
+
+static inline void
+clearEvent(const rtems_event_set event)
+{
+    rtems_event_set received = 0;
+    rtems_event_receive(event, RTEMS_NO_WAIT | RTEMS_EVENT_ANY, RTEMS_NO_TIMEOUT, &received);
+}
+
+UART_INTERRUPT_PATH bool
+handleTxBulk(Uart* const uart, const UartRegisters_t reg, PendingCallbacks* const callbacks)
+{
+    Uart_FlowControl* const flowControl = &uart->flowControl;
+    const bool isFifoInterruptEnabled = isControlFlagSet(uart, UART_CONTROL_TF);
+    if (!isControlFlagSet(uart, UART_CONTROL_TE) || (!isFifoInterruptEnabled && flowControl->pendingByte == 0)) {
+        return false;
+    }
+
+    const bool isTxActive = isFifoInterruptEnabled && !flowControl->isSendingControlOnly;
+    fillTxFifo(uart, reg, callbacks);
+    const bool isEmpty = isTxSourceEmpty(uart);
+    if (!isTxActive || isEmpty || flowControl->isTxPaused) {
+        // The FIFO interrupt is kept only for a control byte that did not fit
+        flowControl->isSendingControlOnly = flowControl->pendingByte != 0;
+        setControlFlag(uart, reg, flowControl->isSendingControlOnly, UART_CONTROL_TF);
+        if (isTxActive && isEmpty) {
+            notifyTxComplete(uart, callbacks);
+        }
+    }
+
+    return true;
+}
+
+UART_INTERRUPT_PATH bool
+handleError(Uart* const uart, const UartRegisters_t reg, PendingCallbacks* const callbacks)
+{
+    bool result = false;
+    const uint32_t status = reg->status;
+
+    if (Uart_getLinkErrors(status, &uart->errorFlags) == true) {
+        uart->statistics.counters.overruns += Uart_getFlag(status, UART_STATUS_OV) ? 1u : 0u;
+        uart->statistics.counters.parityErrors += Uart_getFlag(status, UART_STATUS_PE) ? 1u : 0u;
+        uart->statistics.counters.framingErrors += Uart_getFlag(status, UART_STATUS_FE) ? 1u : 0u;
+        // Error bits stay set until cleared, so each error is counted once
+        if ((status & UART_STATUS_ERROR_MASK) != 0) {
+            reg->status = status & ~UART_STATUS_ERROR_MASK;
+        }
+        callbacks->isError = true;
+        callbacks->errorHandler = uart->errorHandler;
+        result = true;
+    }
+
+    return result;
+}
+
+UART_INTERRUPT_PATH bool
+handleRx(Uart* const uart, const UartRegisters_t reg, PendingCallbacks* const callbacks)
+{
+    updateRxFlowControl(uart);
+    if (uart->isRxBulkModeEnabled) {
+        return drainRxFifo(uart, reg, callbacks) > 0;
+    }
+
+    bool result = false;
+
+    if (isControlFlagSet(uart, UART_CONTROL_RE) && Uart_getFlag(reg->status, UART_STATUS_DR)) {
+        if (isRxSinkSet(uart)) {
+            receiveByte(uart, readData(uart, reg), callbacks);
+            restartRxIdleTimer(uart);
+        } else {
+            discardRxByte(uart, reg);
+        }
+        result = true;
+    }
+
+    return result;
+}
+
+UART_INTERRUPT_PATH bool
+handleTx(Uart* const uart, const UartRegisters_t reg, PendingCallbacks* const callbacks)
+{
+    if (uart->isTxBulkModeEnabled) {
+        return handleTxBulk(uart, reg, callbacks);
+    }
+
+    bool result = false;
+
+    if (isControlFlagSet(uart, UART_CONTROL_TE) && Uart_getFlag(reg->status, UART_STATUS_TS)) {
+        uint8_t buf = '\0';
+        if (pullFlowControlByte(uart, &buf)) {
+            transmitByte(uart, reg, buf);
+        } else if (pullTxByte(uart, &buf, callbacks)) {
+            transmitByte(uart, reg, buf);
+            if (isTxSourceEmpty(uart)) {
+                notifyTxComplete(uart, callbacks);
+            }
+        }
+        result = true;
     }
+
+    return result;
 }
 
-static inline bool
-setBaudRate(const Uart* const uart, const Uart_BaudRate baud)
+UART_INTERRUPT_PATH void
+handleInterrupt(Uart* const uart, const UartRegisters_t reg)
 {
-    uint32_t baudValue = baudRateToValue(baud);
+    PendingCallbacks callbacks;
+    uint32_t interrupts = 1;
+    do {
+        rtems_interrupt_lock_context lockContext;
+        initCallbacks(&callbacks);
+        rtems_interrupt_lock_acquire_isr(&uart->lock, &lockContext);
+        TRACE_RECORD(Trace_Event_UartInterruptEntry, (uint8_t)uart->id, 0, reg->status);
+#ifdef TRACE_ENABLED
+        const uint32_t transferredBytes = getTransferredBytes(uart);
+#endif
+        beginStatisticsUpdate(uart);
+        uart->statistics.counters.interrupts += interrupts;
+        handleError(uart, reg, &callbacks);
+        handleRx(uart, reg, &callbacks);
+        handleTx(uart, reg, &callbacks);
+        endStatisticsUpdate(uart);
+        TRACE_RECORD(Trace_Event_UartInterruptExit,
+                     (uint8_t)uart->id,
+                     (uint16_t)(getTransferredBytes(uart) - transferredBytes),
+                     reg->status);
+        rtems_interrupt_lock_release_isr(&uart->lock, &lockContext);
+        callPendingCallbacks(uart, &callbacks);
+        interrupts = 0;
+    } while (callbacks.isTruncated);
+}
 
-    if (baudValue == 0) {
-        return false;
+#ifdef UART_STATIC_PORTS
+#define UART_DEFINE_PORT_INTERRUPT_HANDLER(port)                  \
+    void Uart_handleInterrupt##port(Uart* const uart)             \
+    {                                                             \
+        handleInterrupt(uart, UART_PORT_REGISTERS(uart, port));   \
     }
 
-    uint32_t freq = rtems_clock_get_ticks_per_second();
-    uint16_t scaler = freq / (baudValue * 8) - 1;
-
-    // Taken from GR712RC User Manual, 15.3
-    uart->reg->clkscl = (scaler << UART_SCALER_RELOAD_OFFSET) & UART_SCALER_RELOAD_MASK;
+UART_DEFINE_PORT_INTERRUPT_HANDLER(0)
+UART_DEFINE_PORT_INTERRUPT_HANDLER(1)
+UART_DEFINE_PORT_INTERRUPT_HANDLER(2)
+UART_DEFINE_PORT_INTERRUPT_HANDLER(3)
+UART_DEFINE_PORT_INTERRUPT_HANDLER(4)
+UART_DEFINE_PORT_INTERRUPT_HANDLER(5)
 
-    return true;
-}
+static const rtems_interrupt_handler portInterruptHandlers[] = {
+    (rtems_interrupt_handler)Uart_handleInterrupt0, (rtems_interrupt_handler)Uart_handleInterrupt1,
+    (rtems_interrupt_handler)Uart_handleInterrupt2, (rtems_interrupt_handler)Uart_handleInterrupt3,
+    (rtems_interrupt_handler)Uart_handleInterrupt4, (rtems_interrupt_handler)Uart_handleInterrupt5,
+};
+#endif
 
-static inline Uart_BaudRate
-getBaudRate(const Uart* const uart)
+static inline rtems_interrupt_handler
+getInterruptHandler(const Uart* const uart)
 {
-    uint32_t freq = rtems_clock_get_ticks_per_second();
-    uint16_t clkscl = (uart->reg->clkscl << UART_CLKSCL_SHIFT) + 1;
-    uint32_t baud = freq / (UART_CLKSCL_DIV * clkscl);
-    return valueToBaudRate(baud);
+#ifdef UART_STATIC_PORTS
+    if (uart->id < Uart_Id_Invalid) {
+        return portInterruptHandlers[uart->id];
+    }
+#else
+    (void)uart;
+#endif
+    return (rtems_interrupt_handler)Uart_handleInterrupt;
 }
 
-static inline Uart_interrupt
-interruptNumber(Uart_Id id)
+bool
+Uart_setInterruptAffinity(Uart* const uart, const uint32_t cpuIndex)
 {
-    switch(id) {
-        case Uart_Id_0:
-            return Uart0_interrupt;
-        case Uart_Id_1:
-            return Uart1_interrupt;
-        case Uart_Id_2:
-            return Uart2_interrupt;
-        case Uart_Id_3:
-            return Uart3_interrupt;
-        case Uart_Id_4:
-            return Uart4_interrupt;
-        case Uart_Id_5:
-            return Uart5_interrupt;
-        default:
-            return UartInvalid_interrupt;
+    if (cpuIndex >= rtems_scheduler_get_processor_maximum()) {
+        return false;
     }
+
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    CPU_SET((int)cpuIndex, &affinity);
+    return rtems_interrupt_set_affinity(uart->interruptData.interruptVector, sizeof(affinity), &affinity) == RTEMS_SUCCESSFUL;
 }
 
-static inline void
-emptyCallback(volatile void* arg)
+bool
+Uart_setConfig(Uart* const uart, const Uart_Config* const config)
 {
-    (void)arg;
+    Uart_PreparedConfig prepared;
+    const bool result = Uart_prepareConfig(config, &prepared);
+    Uart_applyConfig(uart, &prepared);
+    return result;
 }
 
-static Uart_TxHandler defaultTxHandler = { .callback = emptyCallback,
-                                           .arg = 0 };
+bool
+Uart_prepareConfig(const Uart_Config* const config, Uart_PreparedConfig* const prepared)
+{
+    const bool isTxBulkModeEnabled = config->isTxEnabled && config->isTxBulkModeEnabled;
+    const bool isRxBulkModeEnabled = config->isRxEnabled && config->isRxBulkModeEnabled;
+    const bool isParityEnabled = config->parity != Uart_Parity_None && config->parity != Uart_Parity_Invalid;
+    uint32_t control = 0;
 
-static Uart_RxHandler defaultRxHandler = { .lengthCallback = emptyCallback,
-                                           .characterCallback = emptyCallback,
-                                           .lengthArg = 0,
-                                           .characterArg = 0,
-                                           .targetCharacter = '\0',
-                                           .targetLength = 0 };
+    Uart_setFlag(&control, config->isRxEnabled, UART_CONTROL_RE);
+    Uart_setFlag(&control, config->isRxEnabled, UART_CONTROL_RI);
+    Uart_setFlag(&control, !config->isRxEnabled || isRxBulkModeEnabled, UART_CONTROL_RF);
+    Uart_setFlag(&control, isRxBulkModeEnabled, UART_CONTROL_DI);
+    Uart_setFlag(&control, config->isTxEnabled, UART_CONTROL_TE);
+    // In bulk mode Tx FIFO level interrupts are enabled by Uart_writeAsync
+    Uart_setFlag(&control, config->isTxEnabled && !isTxBulkModeEnabled, UART_CONTROL_TI);
+    Uart_setFlag(&control, !config->isTxEnabled, UART_CONTROL_TF);
+    Uart_setFlag(&control, config->isLoopbackModeEnabled, UART_CONTROL_LB);
+    Uart_setFlag(&control, isParityEnabled, UART_CONTROL_PE);
+    Uart_setFlag(&control, isParityEnabled && config->parity == Uart_Parity_Odd, UART_CONTROL_PS);
 
-static Uart_ErrorHandler defaultErrorHandler = { .callback = emptyCallback,
-                                                 .arg = 0 };
+    Uart_BaudRateSetting setting = { 0 };
+    const bool isScalerValid =
+      Uart_computeBaudRateSetting(config->baudRateClkFreq, config->baudRate, &setting);
+
+    *prepared = (Uart_PreparedConfig){
+        .control = control,
+        // Taken from GR712RC User Manual, 15.3
+        .clkscl = (setting.scaler << UART_SCALER_RELOAD_OFFSET) & UART_SCALER_RELOAD_MASK,
+        .isScalerValid = isScalerValid,
+        .isTxBulkModeEnabled = isTxBulkModeEnabled,
+        .isRxBulkModeEnabled = isRxBulkModeEnabled,
+        .baudRate = config->baudRate,
+        .baudRateClkFreq = config->baudRateClkFreq,
+    };
+    return isScalerValid;
+}
 
 void
-Uart_setConfig(Uart* const uart, const Uart_Config* const config)
+Uart_applyConfig(Uart* const uart, const Uart_PreparedConfig* const prepared)
 {
-    Uart_setFlag(&uart->reg->control, config->isRxEnabled, UART_CONTROL_RE);
-    Uart_setFlag(&uart->reg->control, config->isRxEnabled, UART_CONTROL_RI);
-    Uart_setFlag(&uart->reg->control, !config->isRxEnabled, UART_CONTROL_RF);
-    Uart_setFlag(&uart->reg->control, config->isTxEnabled, UART_CONTROL_TE);
-    Uart_setFlag(&uart->reg->control, config->isTxEnabled, UART_CONTROL_TI);
-    Uart_setFlag(&uart->reg->control, !config->isTxEnabled, UART_CONTROL_TF);
-    Uart_setFlag(&uart->reg->control, config->isLoopbackModeEnabled, UART_CONTROL_LB);
-
-    setBaudRate(uart, config->baudRate);
-
-    if (config->parity != Uart_Parity_None && config->parity != Uart_Parity_Invalid) {
-        Uart_setFlag(&uart->reg->control, UART_FLAG_SET, UART_CONTROL_PE);
-        Uart_setFlag(&uart->reg->control, config->parity == Uart_Parity_Odd, UART_CONTROL_PS);
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    initCallbacks(&callbacks);
+    lockDevice(uart, &lockContext);
+    uart->isTxBulkModeEnabled = prepared->isTxBulkModeEnabled;
+    uart->isRxBulkModeEnabled = prepared->isRxBulkModeEnabled;
+    if (prepared->isScalerValid) {
+        uart->reg->clkscl = prepared->clkscl;
+        uart->baudRate = prepared->baudRate;
+        uart->baudRateClkFreq = prepared->baudRateClkFreq;
     }
+    uart->control = prepared->control;
+    uart->reg->control = uart->control;
+    // The prepared word carries no transfer state, an ongoing transfer
+    // re-arms the interrupts of the new mode
+    beginStatisticsUpdate(uart);
+    rearmTx(uart, &callbacks);
+    endStatisticsUpdate(uart);
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
 }
 
 void
 Uart_getConfig(const Uart* const uart, Uart_Config* const config)
 {
-    config->isRxEnabled = Uart_getFlag(uart->reg->control, UART_CONTROL_RE);
-    config->isTxEnabled = Uart_getFlag(uart->reg->control, UART_CONTROL_TE);
-    config->isLoopbackModeEnabled = Uart_getFlag(uart->reg->control, UART_CONTROL_LB);
+    const uint32_t control = uart->control;
+    config->isRxEnabled = Uart_getFlag(control, UART_CONTROL_RE);
+    config->isTxEnabled = Uart_getFlag(control, UART_CONTROL_TE);
+    config->isLoopbackModeEnabled = Uart_getFlag(control, UART_CONTROL_LB);
+    config->isTxBulkModeEnabled = uart->isTxBulkModeEnabled;
+    config->isRxBulkModeEnabled = uart->isRxBulkModeEnabled;
 
-    if (Uart_getFlag (uart->reg->control, UART_CONTROL_PE)) {
-        config->parity = Uart_getFlag(uart->reg->control, UART_CONTROL_PS) ? Uart_Parity_Odd : Uart_Parity_Even;
+    if (Uart_getFlag(control, UART_CONTROL_PE)) {
+        config->parity = Uart_getFlag(control, UART_CONTROL_PS) ? Uart_Parity_Odd : Uart_Parity_Even;
     } else {
         config->parity = Uart_Parity_None;
     }
 
-    config->baudRate = getBaudRate(uart);
-    config->baudRateClkFreq = rtems_clock_get_ticks_per_second();
+    config->baudRate = uart->baudRate;
+    config->baudRateClkFreq = uart->baudRateClkFreq;
+}
+
+bool
+Uart_computeBaudRateSetting(const uint32_t clockFrequency,
+                            const uint32_t baudRate,
+                            Uart_BaudRateSetting* const setting)
+{
+    if (baudRate == 0) {
+        return false;
+    }
+
+    const uint64_t step = (uint64_t)UART_CLKSCL_DIV * baudRate;
+    const uint64_t divisor = clockFrequency / step;
+    const uint64_t maxDivisor = (uint64_t)UART_SCALER_RELOAD_MASK + 1u;
+    if (divisor == 0 || divisor > maxDivisor) {
+        return false;
+    }
+
+    // The rate is a decreasing function of the divisor, the closest one is
+    // either the truncated quotient or the next one
+    uint32_t bestDivisor = (uint32_t)divisor;
+    if (divisor < maxDivisor) {
+        const uint64_t lowerDeviation = getBaudRateDeviation(clockFrequency, baudRate, (uint32_t)divisor);
+        const uint64_t upperDeviation = getBaudRateDeviation(clockFrequency, baudRate, (uint32_t)divisor + 1u);
+        // Compare deviations of the rates, i.e. divided by their divisors
+        if (upperDeviation * divisor < lowerDeviation * (divisor + 1u)) {
+            bestDivisor = (uint32_t)divisor + 1u;
+        }
+    }
+
+    setting->scaler = bestDivisor - 1u;
+    completeBaudRateSetting(clockFrequency, baudRate, setting);
+    return true;
+}
+
+bool
+Uart_getBaudRateSetting(const Uart* const uart, Uart_BaudRateSetting* const setting)
+{
+    if (uart->baudRate == Uart_BaudRate_Invalid) {
+        return false;
+    }
+
+    setting->scaler = (uart->reg->clkscl & UART_SCALER_RELOAD_MASK) >> UART_SCALER_RELOAD_OFFSET;
+    completeBaudRateSetting(uart->baudRateClkFreq, uart->baudRate, setting);
+    return true;
 }
 
 void
@@ -210,21 +1335,22 @@ Uart_startup(Uart* const uart)
     uart->errorFlags = (Uart_ErrorFlags){0};
     rtems_interrupt_entry_initialize(
             &(uart->interruptData.rtemsInterruptEntry),
-            (rtems_interrupt_handler)Uart_handleInterrupt,
+            getInterruptHandler(uart),
             uart,
             "Uart Interrupt");
-    rtems_interrupt_entry_install(interruptNumber(uart->id),
+    rtems_interrupt_entry_install(uart->interruptData.interruptVector,
                                   RTEMS_INTERRUPT_UNIQUE,
                                   &(uart->interruptData.rtemsInterruptEntry));
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+    rtems_interrupt_vector_enable(uart->interruptData.interruptVector);
 }
 
 void
 Uart_shutdown(Uart* const uart)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
-    rtems_interrupt_entry_remove(interruptNumber(uart->id), &(uart->interruptData.rtemsInterruptEntry));
-    uart->reg->control = 0;
+    rtems_interrupt_vector_disable(uart->interruptData.interruptVector);
+    rtems_interrupt_entry_remove(uart->interruptData.interruptVector, &(uart->interruptData.rtemsInterruptEntry));
+    uart->control = 0;
+    uart->reg->control = uart->control;
     uart->reg->status = 0;
     uart->interruptData.sentBytes = 0;
     uart->errorFlags = (Uart_ErrorFlags){0};
@@ -235,20 +1361,37 @@ Uart_init(Uart_Id id, Uart* const uart)
 {
     uart->id = id;
 #ifdef MOCK_REGISTERS
-    uart->reg = malloc(sizeof(UartRegisters_t));
+    uart->reg = calloc(1, sizeof(*uart->reg));
 #else
     uart->reg = getAddressBase(id);
 #endif
     uart->interruptData.rtemsInterruptEntry = (rtems_interrupt_entry){0};
+    uart->interruptData.interruptVector = interruptNumber(id);
     uart->interruptData.sentBytes = 0;
+    uart->interruptData.txTaskId = 0;
+    uart->interruptData.rxTaskId = 0;
     uart->errorFlags = (Uart_ErrorFlags){0};
     uart->txHandler = defaultTxHandler;
     uart->rxHandler = defaultRxHandler;
     uart->errorHandler = defaultErrorHandler;
     uart->txFifo = NULL;
     uart->rxFifo = NULL;
+    uart->txVector = (Uart_TxVector){0};
+    uart->txQueue = (Uart_TxQueue){0};
+    uart->rxBuffers = (Uart_RxBuffers){0};
+    uart->isTxBulkModeEnabled = false;
+    uart->rxCoalescing = (Uart_RxCoalescing){0};
+    uart->rxFraming = (Uart_RxFraming){0};
+    uart->txFraming = (Uart_TxFraming){0};
+    uart->checksums = (Uart_Checksums){0};
+    uart->flowControl = (Uart_FlowControl){0};
+    uart->isRxBulkModeEnabled = false;
+    uart->baudRate = Uart_BaudRate_Invalid;
+    uart->baudRateClkFreq = 0;
+    uart->statistics = (Uart_StatisticsData){0};
+    rtems_interrupt_lock_initialize(&uart->lock, "Uart");
     Uart_shutdown(uart);
-    rtems_interrupt_clear(interruptNumber(uart->id));
+    rtems_interrupt_clear(uart->interruptData.interruptVector);
 }
 
 bool
@@ -257,24 +1400,30 @@ Uart_write(Uart* const uart,
            uint32_t const timeoutLimit,
            Uart_ErrorCode* const errCode)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
-    uint32_t timeout = timeoutLimit;
-    if (uart->txFifo == NULL) {
-        while ((timeoutLimit == 0) || timeout-- > 0) {
-            if (Uart_getFlag(uart->reg->status, UART_STATUS_TS)) {
-                uart->reg->data = data;
-                rtems_interrupt_vector_enable(interruptNumber(uart->id));
-                return true;
-            }
-        }
-        return false;
-    } else {
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
+    const bool isFifoSet = uart->txFifo != NULL;
+    unlockDevice(uart, &lockContext);
+    if (isFifoSet) {
         *errCode = Uart_ErrorCode_TxFifoNotNull;
-        rtems_interrupt_vector_enable(interruptNumber(uart->id));
         return false;
     }
+
+    // The lock is taken for each poll only, so that other processors are not
+    // spinning on it while the transmitter is busy
+    uint32_t timeout = timeoutLimit;
+    while ((timeoutLimit == 0) || timeout-- > 0) {
+        lockDevice(uart, &lockContext);
+        if (Uart_getFlag(uart->reg->status, UART_STATUS_TS)) {
+            beginStatisticsUpdate(uart);
+            transmitByte(uart, uart->reg, data);
+            endStatisticsUpdate(uart);
+            unlockDevice(uart, &lockContext);
+            return true;
+        }
+        unlockDevice(uart, &lockContext);
+    }
     *errCode = Uart_ErrorCode_Timeout;
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
     return false;
 }
 
@@ -284,171 +1433,563 @@ Uart_read(Uart* const uart,
           uint32_t const timeoutLimit,
           Uart_ErrorCode* const errCode)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
     uint32_t timeout = timeoutLimit;
     if (uart->rxFifo == NULL) {
-        rtems_interrupt_vector_enable(interruptNumber(uart->id));
+        unlockDevice(uart, &lockContext);
         do {
             if (uart->errorFlags.hasRxFifoFullErrorOccurred == true) {
                 *errCode = Uart_ErrorCode_RxFifoFull;
                 return false;
             }
             if (Uart_getFlag(uart->reg->status, UART_STATUS_DR)) {
-                *data = uart->reg->data;
+                *data = readData(uart, uart->reg);
+                lockDevice(uart, &lockContext);
+                beginStatisticsUpdate(uart);
+                uart->statistics.counters.rxBytes++;
+                endStatisticsUpdate(uart);
+                unlockDevice(uart, &lockContext);
                 return true;
             }
         } while ((timeoutLimit == 0) || timeout-- > 0);
     } else {
         *errCode = Uart_ErrorCode_RxFifoNotNull;
-        rtems_interrupt_vector_enable(interruptNumber(uart->id));
+        unlockDevice(uart, &lockContext);
         return false;
     }
     *errCode = Uart_ErrorCode_Timeout;
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
     return false;
 }
 
+bool
+Uart_writeBuffer(Uart* const uart,
+                 const uint8_t* const data,
+                 const uint32_t length,
+                 const rtems_interval timeout,
+                 Uart_ErrorCode* const errCode)
+{
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    if (length == 0) {
+        return true;
+    }
+
+    const Uart_Buffer buffer = { .data = data, .length = length };
+    const Uart_TxHandler handler = { .callback = notifyTxTask, .arg = uart };
+    initCallbacks(&callbacks);
+    clearEvent(UART_TX_EVENT);
+    lockDevice(uart, &lockContext);
+    if (isTxBusy(uart)) {
+        unlockDevice(uart, &lockContext);
+        *errCode = Uart_ErrorCode_TxBusy;
+        return false;
+    }
+    uart->interruptData.txTaskId = rtems_task_self();
+    setTxVector(uart, &buffer, 1, handler, false);
+    beginStatisticsUpdate(uart);
+    startVectorTx(uart, &callbacks);
+    endStatisticsUpdate(uart);
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
+    const bool result = waitForEvent(UART_TX_EVENT, timeout);
+
+    // After completion the transmitter may already belong to another client
+    lockDevice(uart, &lockContext);
+    if (uart->txVector.buffers == &buffer) {
+        uart->txVector = (Uart_TxVector){0};
+        uart->txHandler = defaultTxHandler;
+        if (uart->isTxBulkModeEnabled) {
+            setControlFlag(uart, uart->reg, UART_FLAG_RESET, UART_CONTROL_TF);
+        }
+    }
+    unlockDevice(uart, &lockContext);
+
+    if (!result) {
+        clearEvent(UART_TX_EVENT);
+        *errCode = Uart_ErrorCode_Timeout;
+    }
+    return result;
+}
+
+bool
+Uart_readBuffer(Uart* const uart,
+                uint8_t* const data,
+                const uint32_t length,
+                const rtems_interval timeout,
+                uint32_t* const receivedLength,
+                Uart_ErrorCode* const errCode)
+{
+    rtems_interrupt_lock_context lockContext;
+    *receivedLength = 0;
+    if (length == 0) {
+        return true;
+    }
+
+    const Uart_RxBufferHandler handler = { .callback = notifyRxTask, .arg = uart };
+    clearEvent(UART_RX_EVENT);
+    lockDevice(uart, &lockContext);
+    if (isRxSinkSet(uart)) {
+        unlockDevice(uart, &lockContext);
+        *errCode = Uart_ErrorCode_RxFifoNotNull;
+        return false;
+    }
+    uart->interruptData.rxTaskId = rtems_task_self();
+    setRxBuffers(uart, data, length, 1, handler, false);
+    // The interrupt handler detaches the buffer once it is full, so later
+    // bytes are not reported as overflowing it
+    uart->rxBuffers.isOneShot = true;
+    unlockDevice(uart, &lockContext);
+    const bool isNotified = waitForEvent(UART_RX_EVENT, timeout);
+
+    lockDevice(uart, &lockContext);
+    *receivedLength = length;
+    if (uart->rxBuffers.memoryBlock == data) {
+        *receivedLength = uart->rxBuffers.offset;
+        uart->rxBuffers = (Uart_RxBuffers){0};
+    }
+    unlockDevice(uart, &lockContext);
+
+    if (!isNotified) {
+        clearEvent(UART_RX_EVENT);
+    }
+    const bool result = *receivedLength == length;
+    if (!result) {
+        *errCode = Uart_ErrorCode_Timeout;
+    }
+    return result;
+}
+
 void
 Uart_writeAsync(Uart* const uart,
-                ByteFifo* const fifo,
+                Uart_Fifo* const fifo,
                 const Uart_TxHandler handler)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    initCallbacks(&callbacks);
+    lockDevice(uart, &lockContext);
     uart->txFifo = fifo;
+    uart->txVector = (Uart_TxVector){0};
+    uart->txQueue = (Uart_TxQueue){0};
+    uart->txFraming = (Uart_TxFraming){0};
+    restartTxChecksum(uart);
     uart->txHandler = handler;
-    uint8_t byte = '\0';
-    if (Uart_getFlag(uart->reg->status, UART_STATUS_TS)) {
-        ByteFifo_pull(uart->txFifo, &byte);
-        uart->reg->data = byte;
+    beginStatisticsUpdate(uart);
+    startTx(uart, &callbacks);
+    endStatisticsUpdate(uart);
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
+}
+
+void
+Uart_writeVectorAsync(Uart* const uart,
+                      const Uart_Buffer* const buffers,
+                      const uint32_t count,
+                      const Uart_TxHandler handler)
+{
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    initCallbacks(&callbacks);
+    lockDevice(uart, &lockContext);
+    setTxVector(uart, buffers, count, handler, false);
+    beginStatisticsUpdate(uart);
+    startVectorTx(uart, &callbacks);
+    endStatisticsUpdate(uart);
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
+}
+
+void
+Uart_writeFramesAsync(Uart* const uart,
+                      const Uart_Buffer* const frames,
+                      const uint32_t count,
+                      const Uart_TxHandler handler)
+{
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    initCallbacks(&callbacks);
+    lockDevice(uart, &lockContext);
+    setTxVector(uart, frames, count, handler, true);
+    beginStatisticsUpdate(uart);
+    startVectorTx(uart, &callbacks);
+    endStatisticsUpdate(uart);
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
+}
+
+void
+Uart_writeQueueAsync(Uart* const uart,
+                     Uart_TxDescriptor* const descriptors,
+                     const uint32_t capacity)
+{
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
+    uart->txFifo = NULL;
+    uart->txVector = (Uart_TxVector){0};
+    uart->txFraming = (Uart_TxFraming){0};
+    uart->txQueue = (Uart_TxQueue){ .descriptors = descriptors, .capacity = capacity };
+    restartTxChecksum(uart);
+    uart->txHandler = defaultTxHandler;
+    unlockDevice(uart, &lockContext);
+}
+
+bool
+Uart_submitTxBuffer(Uart* const uart, const Uart_TxDescriptor* const descriptor)
+{
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    initCallbacks(&callbacks);
+    lockDevice(uart, &lockContext);
+    Uart_TxQueue* const queue = &uart->txQueue;
+    if (queue->descriptors == NULL || queue->submittedCount - queue->completedCount >= queue->capacity) {
+        unlockDevice(uart, &lockContext);
+        return false;
     }
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+
+    const bool wasEmpty = queue->completedCount == queue->submittedCount;
+    queue->descriptors[queue->submittedCount % queue->capacity] = *descriptor;
+    queue->submittedCount++;
+    if (wasEmpty) {
+        beginStatisticsUpdate(uart);
+        startTx(uart, &callbacks);
+        endStatisticsUpdate(uart);
+    }
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
+    return true;
 }
 
 void
 Uart_readAsync(Uart* const uart,
-               ByteFifo* const fifo,
+               Uart_Fifo* const fifo,
                const Uart_RxHandler handler)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
     uart->rxFifo = fifo;
+    uart->rxBuffers = (Uart_RxBuffers){0};
+    uart->rxCoalescing = (Uart_RxCoalescing){0};
+    uart->rxFraming = (Uart_RxFraming){0};
+    restartRxChecksum(uart);
     uart->rxHandler = handler;
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+    unlockDevice(uart, &lockContext);
+}
+
+void
+Uart_readCoalescedAsync(Uart* const uart,
+                        Uart_Fifo* const fifo,
+                        const Uart_RxBurstHandler handler)
+{
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
+    uart->rxFifo = fifo;
+    uart->rxBuffers = (Uart_RxBuffers){0};
+    uart->rxFraming = (Uart_RxFraming){0};
+    uart->rxCoalescing = (Uart_RxCoalescing){ .isEnabled = true, .pendingBytes = 0, .handler = handler };
+    restartRxChecksum(uart);
+    unlockDevice(uart, &lockContext);
+}
+
+void
+Uart_handleRxIdleTimeout(Uart* const uart)
+{
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    initCallbacks(&callbacks);
+    lockDevice(uart, &lockContext);
+    if (uart->rxCoalescing.isEnabled && uart->rxCoalescing.pendingBytes > 0) {
+        endRxBurst(uart, &callbacks);
+    }
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
+}
+
+void
+Uart_readBuffersAsync(Uart* const uart,
+                      uint8_t* const memoryBlock,
+                      const uint32_t bufferSize,
+                      const uint32_t bufferCount,
+                      const Uart_RxBufferHandler handler)
+{
+    startBufferedRx(uart, memoryBlock, bufferSize, bufferCount, handler, false);
+}
+
+void
+Uart_readFramesAsync(Uart* const uart,
+                     uint8_t* const memoryBlock,
+                     const uint32_t frameSize,
+                     const uint32_t frameCount,
+                     const Uart_RxBufferHandler handler)
+{
+    startBufferedRx(uart, memoryBlock, frameSize, frameCount, handler, true);
+}
+
+bool
+Uart_releaseRxBuffer(Uart* const uart)
+{
+    Uart_RxBuffers* const rxBuffers = &uart->rxBuffers;
+    const uint32_t releasedCount = rxBuffers->releasedCount;
+    const uint32_t filledCount = __atomic_load_n(&rxBuffers->filledCount, __ATOMIC_ACQUIRE);
+
+    if (filledCount == releasedCount) {
+        return false;
+    }
+
+    __atomic_store_n(&rxBuffers->releasedCount, releasedCount + 1u, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint32_t
+Uart_flushRx(Uart* const uart)
+{
+    PendingCallbacks callbacks;
+    uint32_t result = 0;
+    do {
+        rtems_interrupt_lock_context lockContext;
+        initCallbacks(&callbacks);
+        lockDevice(uart, &lockContext);
+        beginStatisticsUpdate(uart);
+        result += drainRxFifo(uart, uart->reg, &callbacks);
+        if (!callbacks.isTruncated && uart->rxBuffers.memoryBlock != NULL && !uart->rxFraming.isEnabled
+            && uart->rxBuffers.offset > 0) {
+            callbacks.isTruncated = callbacks.bufferCount == UART_CALLBACK_BATCH_SIZE;
+            if (!callbacks.isTruncated) {
+                handOverRxBuffer(uart, &callbacks);
+            }
+        }
+        endStatisticsUpdate(uart);
+        unlockDevice(uart, &lockContext);
+        callPendingCallbacks(uart, &callbacks);
+    } while (callbacks.isTruncated);
+    return result;
 }
 
 bool
 Uart_isTxEmpty(const Uart* const uart)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
-    bool result = ByteFifo_isEmpty(uart->txFifo);
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    lockFifo(uart, &lockContext);
+    bool result = isTxSourceEmpty(uart);
+    unlockFifo(uart, &lockContext);
     return result;
 }
 
 bool
 Uart_isRxEmpty(const Uart* const uart)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
-    bool result = ByteFifo_isEmpty(uart->rxFifo);
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    lockFifo(uart, &lockContext);
+    bool result = Uart_Fifo_isEmpty(uart->rxFifo);
+    unlockFifo(uart, &lockContext);
     return result;
 }
 
 uint32_t
 Uart_getTxFifoCount(Uart* const uart)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
-    uint32_t result = ByteFifo_getCount(uart->txFifo);
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    lockFifo(uart, &lockContext);
+    uint32_t result = Uart_Fifo_getCount(uart->txFifo);
+    unlockFifo(uart, &lockContext);
     return result;
 }
 
 uint32_t
 Uart_getRxFifoCount(Uart* const uart)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
-    uint32_t result = ByteFifo_getCount(uart->rxFifo);
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    lockFifo(uart, &lockContext);
+    uint32_t result = Uart_Fifo_getCount(uart->rxFifo);
+    unlockFifo(uart, &lockContext);
+    return result;
+}
+
+static bool
+runHandler(Uart* const uart,
+           bool (*const handler)(Uart* const, const UartRegisters_t, PendingCallbacks* const))
+{
+    PendingCallbacks callbacks;
+    bool result = false;
+    do {
+        rtems_interrupt_lock_context lockContext;
+        initCallbacks(&callbacks);
+        lockDevice(uart, &lockContext);
+        beginStatisticsUpdate(uart);
+        result = handler(uart, uart->reg, &callbacks) || result;
+        endStatisticsUpdate(uart);
+        unlockDevice(uart, &lockContext);
+        callPendingCallbacks(uart, &callbacks);
+    } while (callbacks.isTruncated);
     return result;
 }
 
 bool
 Uart_handleError(Uart* const uart)
 {
-    bool result = false;
+    return runHandler(uart, handleError);
+}
 
-    if (Uart_getLinkErrors(uart->reg->status, &uart->errorFlags) == true) {
-        uart->errorHandler.callback(uart->errorHandler.arg);
-        result = true;
-    }
+bool
+Uart_handleRx(Uart* const uart)
+{
+    return runHandler(uart, handleRx);
+}
 
-    return result;
+bool
+Uart_handleTx(Uart* const uart)
+{
+    return runHandler(uart, handleTx);
+}
+
+void
+Uart_handleInterrupt(Uart* const uart)
+{
+    handleInterrupt(uart, uart->reg);
 }
 
 bool
-Uart_handleRx(Uart* const uart)
+Uart_enableFlowControl(Uart* const uart, const uint32_t highWaterMark, const uint32_t lowWaterMark)
 {
-    bool result = false;
+    rtems_interrupt_lock_context lockContext;
+    if (highWaterMark == 0 || lowWaterMark >= highWaterMark) {
+        return false;
+    }
 
-    if (Uart_getFlag(uart->reg->control, UART_CONTROL_RE) && Uart_getFlag(uart->reg->status, UART_STATUS_DR)) {
-        if (uart->rxFifo != NULL) {
-            uint8_t buf = uart->reg->data;
-            if (ByteFifo_isFull(uart->rxFifo)) {
-                uart->errorFlags.hasRxFifoFullErrorOccurred = true;
-                result = true;
-            } else {
-                if (buf == uart->rxHandler.targetCharacter) {
-                    uart->rxHandler.characterCallback(uart->rxHandler.characterArg);
-                }
-                uart->interruptData.sentBytes++;
-                if (uart->interruptData.sentBytes == uart->rxHandler.targetLength) {
-                    uart->interruptData.sentBytes = 0;
-                    uart->rxHandler.lengthCallback(uart->rxHandler.lengthArg);
-                }
-                ByteFifo_push(uart->rxFifo, buf);
-            }
-        }
-        result = true;
+    lockDevice(uart, &lockContext);
+    if (uart->rxFifo == NULL || highWaterMark > Uart_Fifo_getCapacity(uart->rxFifo)) {
+        unlockDevice(uart, &lockContext);
+        return false;
     }
+    uart->flowControl = (Uart_FlowControl){ .isEnabled = true,
+                                            .highWaterMark = highWaterMark,
+                                            .lowWaterMark = lowWaterMark };
+    unlockDevice(uart, &lockContext);
+    return true;
+}
 
-    return result;
+void
+Uart_disableFlowControl(Uart* const uart)
+{
+    rtems_interrupt_lock_context lockContext;
+    PendingCallbacks callbacks;
+    initCallbacks(&callbacks);
+    lockDevice(uart, &lockContext);
+    Uart_FlowControl* const flowControl = &uart->flowControl;
+    const bool wasTxPaused = flowControl->isTxPaused;
+    if (wasTxPaused) {
+        resumeTx(uart);
+    }
+    if (flowControl->isRxPaused) {
+        flowControl->pendingByte = UART_XON;
+    }
+    flowControl->isEnabled = false;
+    flowControl->isRxPaused = false;
+    beginStatisticsUpdate(uart);
+    startFlowControlTx(uart);
+    // Without FIFO interrupts the transmitter stays idle until a byte is sent
+    if (wasTxPaused && !uart->isTxBulkModeEnabled) {
+        startTx(uart, &callbacks);
+    }
+    endStatisticsUpdate(uart);
+    unlockDevice(uart, &lockContext);
+    callPendingCallbacks(uart, &callbacks);
+}
+
+void
+Uart_updateFlowControl(Uart* const uart)
+{
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
+    updateRxFlowControl(uart);
+    beginStatisticsUpdate(uart);
+    startFlowControlTx(uart);
+    endStatisticsUpdate(uart);
+    unlockDevice(uart, &lockContext);
 }
 
 bool
-Uart_handleTx(Uart* const uart)
+Uart_isTxPaused(const Uart* const uart)
 {
-    bool result = false;
+    return uart->flowControl.isTxPaused;
+}
 
-    if (Uart_getFlag(uart->reg->control, UART_CONTROL_TE) && Uart_getFlag(uart->reg->status, UART_STATUS_TS)) {
-        if (uart->txFifo != NULL) {
-            uint8_t buf = '\0';
-            if (!ByteFifo_isEmpty(uart->txFifo)) {
-                ByteFifo_pull(uart->txFifo, &buf);
-                uart->reg->data = buf;
-                if (ByteFifo_isEmpty(uart->txFifo)) {
-                    uart->txHandler.callback(uart->txHandler.arg);
-                }
-            }
-        }
-        result = true;
-    }
+void
+Uart_setChecksumType(Uart* const uart, const Uart_ChecksumType type)
+{
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
+    uart->checksums.type = type;
+    uart->checksums.lastRx = 0;
+    uart->checksums.lastTx = 0;
+    restartRxChecksum(uart);
+    restartTxChecksum(uart);
+    unlockDevice(uart, &lockContext);
+}
 
-    return result;
+uint32_t
+Uart_getRxChecksum(const Uart* const uart)
+{
+    return finalizeChecksum(uart->checksums.type, uart->checksums.rx);
+}
+
+uint32_t
+Uart_getLastRxChecksum(const Uart* const uart)
+{
+    return __atomic_load_n(&uart->checksums.lastRx, __ATOMIC_RELAXED);
+}
+
+uint32_t
+Uart_getTxChecksum(const Uart* const uart)
+{
+    return finalizeChecksum(uart->checksums.type, uart->checksums.tx);
+}
+
+uint32_t
+Uart_getLastTxChecksum(const Uart* const uart)
+{
+    return __atomic_load_n(&uart->checksums.lastTx, __ATOMIC_RELAXED);
 }
 
 void
-Uart_handleInterrupt(Uart* const uart)
+Uart_getStatistics(const Uart* const uart, Uart_Statistics* const statistics)
+{
+    const Uart_Statistics* const baseline = &uart->statistics.baseline;
+    Uart_Statistics counters;
+    bool isPeakResetPending = false;
+
+    readStatistics(uart, &counters, &isPeakResetPending);
+
+    statistics->txBytes = counters.txBytes - baseline->txBytes;
+    statistics->rxBytes = counters.rxBytes - baseline->rxBytes;
+    statistics->interrupts = counters.interrupts - baseline->interrupts;
+    statistics->overruns = counters.overruns - baseline->overruns;
+    statistics->parityErrors = counters.parityErrors - baseline->parityErrors;
+    statistics->framingErrors = counters.framingErrors - baseline->framingErrors;
+    statistics->rxDrops = counters.rxDrops - baseline->rxDrops;
+    statistics->rxFrameErrors = counters.rxFrameErrors - baseline->rxFrameErrors;
+    statistics->rxQueuePeak = isPeakResetPending ? 0 : counters.rxQueuePeak;
+    statistics->hardwareRxFifoPeak = isPeakResetPending ? 0 : counters.hardwareRxFifoPeak;
+}
+
+void
+Uart_resetStatistics(Uart* const uart)
 {
-    Uart_handleError(uart);
-    Uart_handleRx(uart);
-    Uart_handleTx(uart);
+    Uart_StatisticsData* const statistics = &uart->statistics;
+    bool isPeakResetPending = false;
+
+    // Peaks are not differential, the next update clears them instead
+    readStatistics(uart, &statistics->baseline, &isPeakResetPending);
+    __atomic_store_n(&statistics->peakResetRequest, statistics->peakResetRequest + 1u, __ATOMIC_RELEASE);
 }
 
 void
 Uart_registerErrorHandler(Uart* const uart, const Uart_ErrorHandler handler)
 {
-    rtems_interrupt_vector_disable(interruptNumber(uart->id));
+    rtems_interrupt_lock_context lockContext;
+    lockDevice(uart, &lockContext);
     uart->errorHandler = handler;
-    rtems_interrupt_vector_enable(interruptNumber(uart->id));
+    unlockDevice(uart, &lockContext);
 }
 
 inline bool
@@ -34,11 +34,22 @@
 #define BSP_UART_H
 
 #include <UartRegisters.h>
-#include <ByteFifo.h>
+#include <UartFifo.h>
+#include <Slip.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <rtems.h>
 
+#ifndef UART_TX_EVENT
+/// \brief RTEMS event sent to a task blocked in Uart_writeBuffer.
+#define UART_TX_EVENT RTEMS_EVENT_30
+#endif
+
+#ifndef UART_RX_EVENT
+/// \brief RTEMS event sent to a task blocked in Uart_readBuffer.
+#define UART_RX_EVENT RTEMS_EVENT_31
+#endif
+
 /// \brief Uart device identifiers.
 typedef enum
 {
@@ -60,7 +71,8 @@ typedef enum
     Uart_Parity_Invalid = 9 ///< Error value
 } Uart_Parity;
 
-/// \brief Uart baud rate values.
+/// \brief Named common baud rates. Configurations take the rate as a plain
+///        integer in bauds, so any other rate can be requested as well.
 typedef enum
 {
     Uart_BaudRate_300 = 300,       ///< 300 bauds
@@ -76,6 +88,9 @@ typedef enum
     Uart_BaudRate_57600 = 57600,   ///< 57600 bauds
     Uart_BaudRate_76800 = 76800,   ///< 76800 bauds
     Uart_BaudRate_115200 = 115200, ///< 115200 bauds
+    Uart_BaudRate_230400 = 230400, ///< 230400 bauds
+    Uart_BaudRate_460800 = 460800, ///< 460800 bauds
+    Uart_BaudRate_921600 = 921600, ///< 921600 bauds
     Uart_BaudRate_Invalid = 0      ///< Error value
 } Uart_BaudRate;
 
@@ -87,7 +102,8 @@ typedef enum
     Uart_ErrorCode_RxFifoFull = 2,    ///< Rx FIFO full
     Uart_ErrorCode_TxFifoFull = 3,    ///< Tx FIFO full
     Uart_ErrorCode_TxFifoNotNull = 4, ///< Tx FIFO enabled
-    Uart_ErrorCode_RxFifoNotNull = 5  ///< Rx FIFO enabled
+    Uart_ErrorCode_RxFifoNotNull = 5, ///< Rx FIFO enabled
+    Uart_ErrorCode_TxBusy = 6         ///< Transmission in progress
 } Uart_ErrorCode;
 
 /// \brief Uart configuration descriptor.
@@ -99,19 +115,55 @@ typedef struct
     bool isRxEnabled;
     /// \brief Flag indicating whether to enable local loopback mode
     bool isLoopbackModeEnabled;
+    /// \brief Flag indicating whether the transmitter should fill the whole
+    /// hardware FIFO on each FIFO half-empty interrupt, instead of sending a
+    /// single byte per transmitted frame interrupt
+    bool isTxBulkModeEnabled;
+    /// \brief Flag indicating whether the receiver should drain the whole
+    /// hardware FIFO on each FIFO half-full interrupt, with a delayed
+    /// interrupt flushing the remaining bytes once the line goes idle
+    bool isRxBulkModeEnabled;
     /// \brief Indicator of used parity bit
     Uart_Parity parity;
-    /// \brief Target baud rate
-    Uart_BaudRate baudRate;
-    /// \brief Baud rate clock source frequency
+    /// \brief Target baud rate in bauds, Uart_BaudRate_Invalid keeps the
+    /// current scaler
+    uint32_t baudRate;
+    /// \brief Baud rate clock source (system clock) frequency in Hz, required
+    /// to change the baud rate
     uint32_t baudRateClkFreq;
 } Uart_Config;
 
+/// \brief Register words built from a configuration descriptor, applied to
+///        a device with a single write per register.
+typedef struct
+{
+    uint32_t control;         ///< Control register word
+    uint32_t clkscl;          ///< Scaler register word
+    bool isScalerValid;       ///< Scaler computed, otherwise the current one
+                              ///< is kept
+    bool isTxBulkModeEnabled; ///< Hardware Tx FIFO bulk-fill mode flag
+    bool isRxBulkModeEnabled; ///< Hardware Rx FIFO bulk-drain mode flag
+    uint32_t baudRate;        ///< Target baud rate
+    uint32_t baudRateClkFreq; ///< Scaler clock frequency
+} Uart_PreparedConfig;
+
+/// \brief Clock scaler setting closest to a target baud rate.
+typedef struct
+{
+    uint32_t scaler;           ///< 12-bit clock scaler reload value
+    uint32_t achievedBaudRate; ///< Baud rate generated with the scaler
+    int32_t errorBasisPoints;  ///< Deviation of the achieved rate from the
+                               ///< target, in hundredths of a percent
+} Uart_BaudRateSetting;
+
 /// \brief Internal data used by interrupt handler
 typedef struct
 {
     rtems_interrupt_entry rtemsInterruptEntry; ///< RTEMS interrupt entry
+    rtems_vector_number interruptVector;       ///< Interrupt vector of device
     uint32_t sentBytes;                        ///< Bytes sent in async mode
+    rtems_id txTaskId; ///< Task blocked in Uart_writeBuffer
+    rtems_id rxTaskId; ///< Task blocked in Uart_readBuffer
 } Uart_InterruptData;
 
 /// \brief A function serving as a callback called at the end of transmission.
@@ -124,6 +176,45 @@ typedef struct
     volatile void* arg;         ///< Argument to the callback function
 } Uart_TxHandler;
 
+/// \brief A descriptor of a caller-owned buffer used in scatter-gather
+///        transfers.
+typedef struct
+{
+    const uint8_t* data; ///< Pointer to the buffer
+    uint32_t length;     ///< Number of bytes in the buffer
+} Uart_Buffer;
+
+/// \brief State of a scatter-gather transmission.
+typedef struct
+{
+    const Uart_Buffer* buffers; ///< Array of buffers being sent
+    uint32_t count;             ///< Number of buffers in the array
+    uint32_t index;             ///< Index of the buffer being sent
+    uint32_t offset;            ///< Offset of the next byte in the buffer
+} Uart_TxVector;
+
+/// \brief A descriptor of a caller-owned buffer queued for transmission, with
+///        its own end-of-transmission handler.
+typedef struct
+{
+    const uint8_t* data;    ///< Pointer to the buffer
+    uint32_t length;        ///< Number of bytes in the buffer
+    Uart_TxHandler handler; ///< Handler called after the last byte is sent
+} Uart_TxDescriptor;
+
+/// \brief State of queued transmission. Descriptors are submitted at the
+///        tail of a caller-provided ring and completed in order by the
+///        interrupt handler, which moves on to the next one without waiting
+///        for the application. Each counter is written by one side only.
+typedef struct
+{
+    Uart_TxDescriptor* descriptors;   ///< Ring of submitted descriptors
+    uint32_t capacity;                ///< Number of descriptors in the ring
+    uint32_t offset;                  ///< Offset of the next byte to send
+    volatile uint32_t submittedCount; ///< Number of descriptors submitted
+    volatile uint32_t completedCount; ///< Number of descriptors completed
+} Uart_TxQueue;
+
 /// \brief A function serving as a callback called upon a reception of a byte
 ///        if the reception queue contains at least a number of bytes specified
 ///        in the handler descriptor.
@@ -153,6 +244,124 @@ typedef struct
     uint32_t targetLength;
 } Uart_RxHandler;
 
+/// \brief A function serving as a callback called when a reception buffer is
+///        handed over to the application.
+typedef void (*UartRxBufferCallback)(volatile void* arg,
+                                     uint8_t* buffer,
+                                     uint32_t length);
+
+/// \brief A descriptor of a reception buffer hand-over event handler.
+typedef struct
+{
+    UartRxBufferCallback callback; ///< Callback function
+    volatile void* arg;            ///< Argument to the callback function
+} Uart_RxBufferHandler;
+
+/// \brief State of multi-buffered reception. The interrupt handler fills the
+///        buffers in order and hands each one over when it is full, the
+///        application returns them in the same order. Each counter is written
+///        by one side only.
+typedef struct
+{
+    uint8_t* memoryBlock;            ///< Memory block divided into buffers
+    uint32_t bufferSize;             ///< Size of a single buffer
+    uint32_t bufferCount;            ///< Number of buffers in memory block
+    uint32_t offset;                 ///< Number of bytes in buffer being filled
+    volatile uint32_t filledCount;   ///< Number of buffers handed over
+    volatile uint32_t releasedCount; ///< Number of buffers released
+    Uart_RxBufferHandler handler;    ///< Buffer hand-over handler descriptor
+    bool isOneShot;                  ///< Reception ends with first hand-over
+} Uart_RxBuffers;
+
+/// \brief State of SLIP framed reception into multi-buffered reception
+///        buffers, one frame per buffer.
+typedef struct
+{
+    bool isEnabled;      ///< Framed reception active flag
+    bool isDiscarding;   ///< Rest of the current frame is dropped
+    SlipDecoder decoder; ///< Byte stuffing decoder
+} Uart_RxFraming;
+
+/// \brief State of SLIP framed transmission of scatter-gather buffers, one
+///        frame per buffer.
+typedef struct
+{
+    bool isEnabled;      ///< Framed transmission active flag
+    bool isFrameOpen;    ///< Opening delimiter of current frame was sent
+    SlipEncoder encoder; ///< Byte stuffing encoder
+} Uart_TxFraming;
+
+/// \brief A function serving as a callback called when a burst of received
+///        bytes is complete.
+typedef void (*UartRxBurstCallback)(volatile void* arg, uint32_t length);
+
+/// \brief One-shot timer ending a burst of received bytes after a period of
+///        line silence. Its expiry interrupt has to call
+///        Uart_handleRxIdleTimeout, see UartIdleTimer.h for a GPTIMER binding.
+typedef struct
+{
+    /// \brief (Re)starts the countdown of timeout ticks
+    void (*restart)(volatile void* timer, const uint32_t timeout);
+    /// \brief Stops the countdown
+    void (*stop)(volatile void* timer);
+    volatile void* timer; ///< Timer passed to the functions
+} Uart_IdleTimer;
+
+/// \brief A descriptor of a coalescing reception handler. The callback is
+///        called once per burst, when threshold bytes were received or when
+///        the line stayed silent for idleTimeout ticks after the last byte.
+typedef struct
+{
+    UartRxBurstCallback callback; ///< Callback function
+    volatile void* arg;           ///< Argument to the callback function
+    uint32_t threshold;           ///< Burst length limit, 0 for no limit
+    uint32_t idleTimeout;         ///< Silence ending a burst, in timer ticks
+    Uart_IdleTimer idleTimer;     ///< Timer measuring line silence
+} Uart_RxBurstHandler;
+
+/// \brief State of coalescing reception.
+typedef struct
+{
+    bool isEnabled;              ///< Coalescing reception active flag
+    uint32_t pendingBytes;       ///< Bytes received since the last callback
+    Uart_RxBurstHandler handler; ///< Burst handler descriptor
+} Uart_RxCoalescing;
+
+/// \brief Running checksum algorithms.
+typedef enum
+{
+    Uart_ChecksumType_None = 0,  ///< No checksum
+    Uart_ChecksumType_Crc16 = 1, ///< CRC-16/CCITT-FALSE
+    Uart_ChecksumType_Crc32 = 2, ///< CRC-32 (IEEE 802.3)
+} Uart_ChecksumType;
+
+/// \brief State of running checksums of transferred payload bytes.
+typedef struct
+{
+    Uart_ChecksumType type; ///< Checksum algorithm
+    uint32_t rx;            ///< Running reception CRC value
+    uint32_t tx;            ///< Running transmission CRC value
+    uint32_t lastRx;        ///< Checksum of the last handed over block
+    uint32_t lastTx;        ///< Checksum of the last completed transmission
+} Uart_Checksums;
+
+/// \brief Software flow control character resuming transmission (DC1).
+#define UART_XON 0x11u
+/// \brief Software flow control character suspending transmission (DC3).
+#define UART_XOFF 0x13u
+
+/// \brief State of software (XON/XOFF) flow control.
+typedef struct
+{
+    bool isEnabled;            ///< Flow control active flag
+    bool isTxPaused;           ///< XOFF received, transmission suspended
+    bool isRxPaused;           ///< XOFF sent, remote transmission suspended
+    bool isSendingControlOnly; ///< Tx FIFO interrupt enabled for pendingByte
+    uint8_t pendingByte;       ///< XON or XOFF waiting to be sent, 0 if none
+    uint32_t highWaterMark;    ///< Reception queue count triggering XOFF
+    uint32_t lowWaterMark;     ///< Reception queue count triggering XON
+} Uart_FlowControl;
+
 /// \brief A function serving as a callback called upon detection of an error by
 ///        hardware.
 typedef void (*UartErrorCallback)(volatile void* arg);
@@ -173,6 +382,36 @@ typedef struct
     bool hasRxFifoFullErrorOccurred; //< Rx FIFO full error detected
 } Uart_ErrorFlags;
 
+/// \brief Uart runtime statistics. Counters wrap around on overflow.
+typedef struct
+{
+    uint32_t txBytes;            ///< Bytes written to the hardware
+    uint32_t rxBytes;            ///< Bytes read from the hardware
+    uint32_t interrupts;         ///< Interrupts handled
+    uint32_t overruns;           ///< Hardware overrun errors
+    uint32_t parityErrors;       ///< Parity errors
+    uint32_t framingErrors;      ///< Framing errors
+    uint32_t rxDrops;            ///< Bytes dropped on full reception queue
+                                 ///< or without reception sink
+    uint32_t rxFrameErrors;      ///< Oversized or malformed frames dropped
+    uint32_t rxQueuePeak;        ///< Peak number of bytes waiting in reception
+                                 ///< queue or buffers
+    uint32_t hardwareRxFifoPeak; ///< Peak number of frames in hardware Rx FIFO
+} Uart_Statistics;
+
+/// \brief Storage of Uart runtime statistics. Counters are updated with the
+///        descriptor lock held, between two increments of the sequence
+///        counter, so that a reader can take a consistent copy without the
+///        lock by retrying while the sequence is odd or changes.
+typedef struct
+{
+    Uart_Statistics counters;           ///< Counters since initialization
+    Uart_Statistics baseline;           ///< Counters at the last reset
+    volatile uint32_t sequence;         ///< Update sequence counter
+    volatile uint32_t peakResetRequest; ///< Peak resets requested by reader
+    volatile uint32_t peakResetAck;     ///< Peak resets applied by writer
+} Uart_StatisticsData;
+
 /// \brief Uart device descriptor.
 typedef struct
 {
@@ -182,21 +421,110 @@ typedef struct
     Uart_ErrorHandler errorHandler; ///< Error handler descriptor
     Uart_ErrorFlags errorFlags;     ///< Error flags
     Uart_InterruptData interruptData; ///< Interrupt handler internal data
-    ByteFifo* txFifo;                 ///< Pointer to a transmission byte queue
-    ByteFifo* rxFifo;                 ///< Pointer to a reception byte queue
+    Uart_Fifo* txFifo;                ///< Pointer to a transmission byte queue
+    Uart_Fifo* rxFifo;                ///< Pointer to a reception byte queue
+    Uart_TxVector txVector;           ///< Scatter-gather transmission state
+    Uart_TxQueue txQueue;             ///< Queued transmission state
+    Uart_RxBuffers rxBuffers;         ///< Multi-buffered reception state
+    Uart_RxCoalescing rxCoalescing;   ///< Coalescing reception state
+    Uart_RxFraming rxFraming;         ///< Framed reception state
+    Uart_TxFraming txFraming;         ///< Framed transmission state
+    Uart_Checksums checksums;         ///< Running checksums state
+    Uart_FlowControl flowControl;     ///< Software flow control state
+    bool isTxBulkModeEnabled;         ///< Hardware Tx FIFO bulk-fill mode flag
+    bool isRxBulkModeEnabled;         ///< Hardware Rx FIFO bulk-drain mode flag
+    uint32_t control;                 ///< Shadow copy of the control register
+    uint32_t baudRate;                ///< Configured target baud rate
+    uint32_t baudRateClkFreq;         ///< Configured scaler clock frequency
+    Uart_StatisticsData statistics;   ///< Runtime statistics
+    /// \brief Lock protecting the descriptor against the interrupt handler,
+    ///        which may be serviced by another processor
+    RTEMS_INTERRUPT_LOCK_MEMBER(lock)
     UartRegisters_t reg; ///< Pointer to memory-mapped device registers
 } Uart;
 
-/// \brief Configures an Uart device based on a configuration descriptor.
+#ifdef MOCK_REGISTERS
+/// \brief Hooks emulating side effects of data register accesses, used by
+///        host-side device models. A NULL hook falls back to plain memory.
+typedef struct
+{
+    /// \brief Called instead of reading the data register
+    uint8_t (*readData)(Uart* const uart);
+    /// \brief Called instead of writing the data register
+    void (*writeData)(Uart* const uart, const uint8_t data);
+} Uart_MockRegisterHooks;
+
+/// \brief Data register access hooks used by all Uart devices.
+extern Uart_MockRegisterHooks Uart_mockRegisterHooks;
+#endif
+
+/// \brief Routes the interrupt of an Uart device to a single processor. All
+///        Uart handlers are called on that processor, so ports pinned to
+///        different processors are serviced in parallel.
 /// \param [in] uart Uart device descriptor.
+/// \param [in] cpuIndex Index of the processor servicing the interrupt.
+/// \retval true   affinity set
+/// \retval false  processor index out of range or affinity not supported by
+///                the interrupt controller
+bool Uart_setInterruptAffinity(Uart* const uart, const uint32_t cpuIndex);
+
+/// \brief Configures an Uart device based on a configuration descriptor,
+///        equivalent to Uart_prepareConfig followed by Uart_applyConfig.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] config A configuration descriptor.
+/// \retval true Configuration applied.
+/// \retval false Baud rate cannot be generated, e.g. baudRateClkFreq is 0,
+///                the current scaler was kept and the rest of the
+///                configuration applied.
+bool Uart_setConfig(Uart* const uart, const Uart_Config* const config);
+
+/// \brief Builds the register words of a configuration, e.g. once at startup
+///        for each mode an application switches between.
 /// \param [in] config A configuration descriptor.
-void Uart_setConfig(Uart* const uart, const Uart_Config* const config);
+/// \param [out] prepared Register words of the configuration.
+/// \retval true Configuration prepared.
+/// \retval false Baud rate cannot be generated, the current scaler will be
+///                kept.
+bool Uart_prepareConfig(const Uart_Config* const config,
+                        Uart_PreparedConfig* const prepared);
+
+/// \brief Applies a prepared configuration with one write of the scaler and
+///        one write of the control register, under the descriptor lock. The
+///        driver keeps a shadow copy of the control register, so interrupt
+///        handlers test control flags without bus accesses. A transfer in
+///        progress continues in the new mode: its interrupts are enabled again
+///        and its remaining data is sent.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] prepared Register words of the configuration.
+void Uart_applyConfig(Uart* const uart,
+                      const Uart_PreparedConfig* const prepared);
 
 /// \brief Retrieves configuration of an Uart device.
 /// \param [in] uart Uart device descriptor.
 /// \param [out] config A configuration descriptor.
 void Uart_getConfig(const Uart* const uart, Uart_Config* const config);
 
+/// \brief Computes the clock scaler generating the baud rate closest to the
+///        target, as baudRate = clockFrequency / (8 * (scaler + 1)).
+/// \param [in] clockFrequency Scaler clock (system clock) frequency in Hz.
+/// \param [in] baudRate Target baud rate, any integer rate.
+/// \param [out] setting Scaler with the achieved rate and its error.
+/// \retval true Setting computed.
+/// \retval false Target rate or clock frequency is 0, or the rate is outside
+///                of the range of the 12-bit scaler at the given frequency.
+bool Uart_computeBaudRateSetting(const uint32_t clockFrequency,
+                                 const uint32_t baudRate,
+                                 Uart_BaudRateSetting* const setting);
+
+/// \brief Reports the scaler applied by the last Uart_setConfig together with
+///        the achieved baud rate and its error against the configured target.
+/// \param [in] uart Uart device descriptor.
+/// \param [out] setting Applied scaler setting.
+/// \retval true Setting reported.
+/// \retval false No baud rate was configured.
+bool Uart_getBaudRateSetting(const Uart* const uart,
+                             Uart_BaudRateSetting* const setting);
+
 /// \brief Performs a hardware startup procedure of an Uart device.
 /// \param [in] uart Uart device descriptor.
 void Uart_startup(Uart* const uart);
@@ -234,25 +562,178 @@ bool Uart_read(Uart* const uart,
                uint32_t timeoutLimit,
                Uart_ErrorCode* const errCode);
 
+/// \brief Sends a series of bytes over Uart, blocking the calling task until
+///        all of them are handed over to the hardware. The transfer is
+///        interrupt-driven and the task sleeps on UART_TX_EVENT meanwhile.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] data Bytes to send.
+/// \param [in] length Number of bytes to send.
+/// \param [in] timeout Timeout in clock ticks, RTEMS_NO_TIMEOUT waits forever.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Sending was successful.
+/// \retval false Sending timed out, or another transmission or a transmit
+///         descriptor queue holds the transmitter (Uart_ErrorCode_TxBusy).
+bool Uart_writeBuffer(Uart* const uart,
+                      const uint8_t* const data,
+                      const uint32_t length,
+                      const rtems_interval timeout,
+                      Uart_ErrorCode* const errCode);
+
+/// \brief Receives a series of bytes over Uart, blocking the calling task
+///        until all of them arrive. The transfer is interrupt-driven and the
+///        task sleeps on UART_RX_EVENT meanwhile.
+/// \param [in] uart Uart device descriptor.
+/// \param [out] data Buffer for received bytes.
+/// \param [in] length Number of bytes to receive.
+/// \param [in] timeout Timeout in clock ticks, RTEMS_NO_TIMEOUT waits forever.
+/// \param [out] receivedLength Number of bytes stored in the buffer, also
+///        when reception timed out.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Reception was successful.
+/// \retval false Reception timed out or asynchronous reception is active.
+bool Uart_readBuffer(Uart* const uart,
+                     uint8_t* const data,
+                     const uint32_t length,
+                     const rtems_interval timeout,
+                     uint32_t* const receivedLength,
+                     Uart_ErrorCode* const errCode);
+
 /// \brief Asynchronously sends a series of bytes over Uart.
 /// \param [in] uart Uart device descriptor.
 /// \param [in] fifo Pointer to the output byte queue.
 /// \param [in] handler Descriptor of the transmission handler.
 void Uart_writeAsync(Uart* const uart,
-                     ByteFifo* const fifo,
+                     Uart_Fifo* const fifo,
                      const Uart_TxHandler handler);
 
+/// \brief Asynchronously sends the contents of a list of buffers over Uart,
+///        directly from the interrupt handler and without copying them into a
+///        byte queue. The buffers and the list itself have to remain valid
+///        until the end-of-transmission callback, which is called once after
+///        the last byte of the last buffer. With nothing to send it is
+///        called before the function returns.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] buffers Array of buffer descriptors.
+/// \param [in] count Number of buffer descriptors in the array.
+/// \param [in] handler Descriptor of the transmission handler.
+void Uart_writeVectorAsync(Uart* const uart,
+                           const Uart_Buffer* const buffers,
+                           const uint32_t count,
+                           const Uart_TxHandler handler);
+
+/// \brief Asynchronously sends a list of buffers over Uart as SLIP frames, one
+///        frame per buffer. Byte stuffing is applied by the interrupt handler
+///        while sending, with the same buffer lifetime and completion rules
+///        as Uart_writeVectorAsync.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] frames Array of frame payload descriptors.
+/// \param [in] count Number of frames in the array.
+/// \param [in] handler Descriptor of the transmission handler.
+void Uart_writeFramesAsync(Uart* const uart,
+                           const Uart_Buffer* const frames,
+                           const uint32_t count,
+                           const Uart_TxHandler handler);
+
+/// \brief Starts queued transmission. Buffers submitted with
+///        Uart_submitTxBuffer are sent back to back by the interrupt handler,
+///        which calls the handler of each descriptor after its last byte and
+///        continues with the next descriptor in the same interrupt, so the
+///        line does not go idle while the queue is not empty.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] descriptors Storage for capacity descriptors, owned by the
+///             driver until another transmission is started.
+/// \param [in] capacity Maximum number of descriptors waiting in the queue.
+void Uart_writeQueueAsync(Uart* const uart,
+                          Uart_TxDescriptor* const descriptors,
+                          const uint32_t capacity);
+
+/// \brief Appends a buffer to the queue of Uart_writeQueueAsync. The buffer
+///        has to remain valid until the descriptor handler is called. Must not
+///        be called from Uart handlers.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] descriptor Descriptor of the buffer to send, copied into the
+///             queue.
+/// \retval true Buffer was queued.
+/// \retval false Queue is full or queued transmission is not started.
+bool Uart_submitTxBuffer(Uart* const uart,
+                         const Uart_TxDescriptor* const descriptor);
+
 /// \brief Asynchronously receives a series of bytes over Uart.
 /// \param [in] uart Uart device descriptor.
 /// \param [in] fifo Pointer to the input byte queue.
 /// \param [in] handler Descriptor of the reception handler.
 void Uart_readAsync(Uart* const uart,
-                    ByteFifo* const fifo,
+                    Uart_Fifo* const fifo,
                     const Uart_RxHandler handler);
 
+/// \brief Moves all frames pending in the hardware Rx FIFO to the reception
+///        queue, e.g. when the line goes idle before the FIFO half-full
+///        interrupt is triggered. In multi-buffered mode a partially filled
+///        buffer is handed over as well, unless it holds a partial frame.
+/// \param [in] uart Uart device descriptor.
+/// \returns The number of bytes drained from the hardware FIFO.
+uint32_t Uart_flushRx(Uart* const uart);
+
+/// \brief Asynchronously receives bytes over Uart into a queue, notifying the
+///        application once per burst instead of per byte. A burst ends when
+///        the handler threshold is reached or when no byte arrives for the
+///        handler idle timeout.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] fifo Pointer to a reception byte queue.
+/// \param [in] handler Descriptor of the burst handler.
+void Uart_readCoalescedAsync(Uart* const uart,
+                             Uart_Fifo* const fifo,
+                             const Uart_RxBurstHandler handler);
+
+/// \brief Ends the pending burst of coalescing reception. Has to be called by
+///        the interrupt handler of the idle timer.
+/// \param [in] uart Uart device descriptor.
+void Uart_handleRxIdleTimeout(Uart* const uart);
+
+/// \brief Asynchronously receives bytes over Uart into a set of fixed-size
+///        buffers. The interrupt handler fills one buffer while the application
+///        owns the others, and hands each buffer over through the handler
+///        callback once it is full. Bytes received while all buffers are owned
+///        by the application are dropped and reported as an Rx FIFO full error.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] memoryBlock Memory block of bufferCount * bufferSize bytes.
+/// \param [in] bufferSize Size of a single buffer.
+/// \param [in] bufferCount Number of buffers, at least 2 for double buffering.
+/// \param [in] handler Descriptor of the buffer hand-over handler.
+void Uart_readBuffersAsync(Uart* const uart,
+                           uint8_t* const memoryBlock,
+                           const uint32_t bufferSize,
+                           const uint32_t bufferCount,
+                           const Uart_RxBufferHandler handler);
+
+/// \brief Asynchronously receives SLIP frames over Uart. The interrupt handler
+///        removes byte stuffing and hands each complete, non-empty frame over
+///        in its own buffer, as Uart_readBuffersAsync does, so buffers are
+///        returned with Uart_releaseRxBuffer. Frames longer than frameSize or
+///        with invalid escape sequences are dropped and counted as frame
+///        errors, frames arriving while all buffers are owned by the
+///        application are dropped as on full reception queue.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] memoryBlock Memory block of frameCount * frameSize bytes.
+/// \param [in] frameSize Maximum decoded length of a frame.
+/// \param [in] frameCount Number of frame buffers.
+/// \param [in] handler Descriptor of the frame hand-over handler.
+void Uart_readFramesAsync(Uart* const uart,
+                          uint8_t* const memoryBlock,
+                          const uint32_t frameSize,
+                          const uint32_t frameCount,
+                          const Uart_RxBufferHandler handler);
+
+/// \brief Returns the oldest buffer handed over by Uart_readBuffersAsync to
+///        the interrupt handler. Does not mask the interrupt vector.
+/// \param [in] uart Uart device descriptor.
+/// \retval true Buffer was released.
+/// \retval false No buffer is owned by the application.
+bool Uart_releaseRxBuffer(Uart* const uart);
+
 /// \brief Checks if all bytes were sent.
 /// \param [in] uart Uart device descriptor.
-/// \retval true Tx queue is empty.
+/// \retval true Tx queue or buffer list is empty.
 /// \retval false Tx is busy.
 bool Uart_isTxEmpty(const Uart* const uart);
 
@@ -272,38 +753,147 @@ uint32_t Uart_getTxFifoCount(Uart* const uart);
 /// \returns The number of bytes in the reception queue, waiting to be pulled.
 uint32_t Uart_getRxFifoCount(Uart* const uart);
 
+/// \brief Enables XON/XOFF flow control handled by the interrupt handler.
+///        Received XON and XOFF bytes are consumed and resume or suspend
+///        interrupt-driven transmission at once, bytes already in the hardware
+///        Tx FIFO are still sent. XOFF is sent when the reception queue of
+///        Uart_readAsync or Uart_readCoalescedAsync reaches highWaterMark,
+///        XON when it drops to lowWaterMark again. Control bytes are sent
+///        ahead of queued data. The reception queue has to be attached
+///        before, the water marks are checked against its capacity.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] highWaterMark Reception queue count sending XOFF.
+/// \param [in] lowWaterMark Reception queue count sending XON.
+/// \retval true Flow control was enabled.
+/// \retval false No reception queue is attached, highWaterMark is zero or
+///         above the queue capacity, or lowWaterMark is not below it.
+bool Uart_enableFlowControl(Uart* const uart,
+                            const uint32_t highWaterMark,
+                            const uint32_t lowWaterMark);
+
+/// \brief Disables XON/XOFF flow control, resuming suspended transmission and
+///        sending XON if the remote end was suspended.
+/// \param [in] uart Uart device descriptor.
+void Uart_disableFlowControl(Uart* const uart);
+
+/// \brief Checks the reception queue against the low-water mark after the
+///        application pulled bytes from it. The interrupt handler does the
+///        same check on each interrupt, this call is needed to send XON when
+///        the line is otherwise idle.
+/// \param [in] uart Uart device descriptor.
+void Uart_updateFlowControl(Uart* const uart);
+
+/// \brief Checks if transmission is suspended by a received XOFF.
+/// \param [in] uart Uart device descriptor.
+/// \retval true Transmission is suspended.
+/// \retval false Transmission is not suspended.
+bool Uart_isTxPaused(const Uart* const uart);
+
+/// \brief Selects the algorithm of running checksums, computed by the
+///        interrupt handler over payload bytes as they are transferred, i.e.
+///        before byte stuffing on transmission and after its removal on
+///        reception. Restarts both checksums.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] type Checksum algorithm.
+void Uart_setChecksumType(Uart* const uart, const Uart_ChecksumType type);
+
+/// \brief Gets checksum of bytes received since the start of reception or the
+///        last hand-over of a buffer, frame or burst.
+/// \param [in] uart Uart device descriptor.
+/// \returns Checksum value.
+uint32_t Uart_getRxChecksum(const Uart* const uart);
+
+/// \brief Gets checksum of the buffer, frame or burst most recently handed
+///        over to the application. In its callback it is the checksum of the
+///        handed over block, also when one interrupt completes several.
+/// \param [in] uart Uart device descriptor.
+/// \returns Checksum value.
+uint32_t Uart_getLastRxChecksum(const Uart* const uart);
+
+/// \brief Gets checksum of bytes sent since the start of the current
+///        asynchronous transmission or queued buffer.
+/// \param [in] uart Uart device descriptor.
+/// \returns Checksum value.
+uint32_t Uart_getTxChecksum(const Uart* const uart);
+
+/// \brief Gets checksum of the asynchronous transmission or queued buffer
+///        most recently completed. In its end-of-transmission callback it is
+///        the checksum of that transmission, also when one interrupt
+///        completes several queued buffers.
+/// \param [in] uart Uart device descriptor.
+/// \returns Checksum value.
+uint32_t Uart_getLastTxChecksum(const Uart* const uart);
+
+/// \brief Takes a consistent copy of runtime statistics without blocking the
+///        interrupt handler. Counters are reported since the last reset.
+///        Statistics are updated under the descriptor lock only and handlers
+///        are called after it is released, so they may read statistics too.
+/// \param [in] uart Uart device descriptor.
+/// \param [out] statistics Statistics since the last reset.
+void Uart_getStatistics(const Uart* const uart,
+                        Uart_Statistics* const statistics);
+
+/// \brief Restarts runtime statistics without blocking the interrupt
+///        handler. Statistics should be read and reset from a single task.
+/// \param [in] uart Uart device descriptor.
+void Uart_resetStatistics(Uart* const uart);
+
 /// \brief Registers a handler called upon detection of a hardware error.
 /// \param [in] uart Uart device descriptor.
 /// \param [in] handler Error handler descriptor.
 void Uart_registerErrorHandler(Uart* const uart,
                                const Uart_ErrorHandler handler);
 
-/// \brief Default interrupt handler for Uart devices.
+/// \brief Default interrupt handler for Uart devices. Counts and clears
+///        sticky overrun, parity and framing error flags. Like
+///        Uart_handleInterrupt it updates statistics under the descriptor
+///        lock and calls handlers after releasing it.
 /// \param [in] arg Uart device descriptor passed directly to RTEMS interrupt
 ///                  handler
 /// \retval true   error handled by interrupt
 /// \retval false  no error occured
 bool Uart_handleError(Uart* const uart);
 
-/// \brief Default interrupt handler for Uart devices.
+/// \brief Default interrupt handler for Uart devices. In bulk mode it drains
+///        all frames pending in the hardware Rx FIFO. Locking and handler
+///        calls are the same as in Uart_handleError.
 /// \param [in] arg Uart device descriptor passed directly to RTEMS interrupt
 ///                  handler
 /// \retval true   received byte handled by interrupt
 /// \retval false  no byte received
 bool Uart_handleRx(Uart* const uart);
 
-/// \brief Default interrupt handler for Uart devices.
+/// \brief Default interrupt handler for Uart devices. In bulk mode it keeps
+///        writing bytes until the hardware Tx FIFO reports full. Locking and
+///        handler calls are the same as in Uart_handleError.
 /// \param [in] arg Uart device descriptor passed directly to RTEMS interrupt
 ///                  handler
 /// \retval true   sent byte handled by interrupt
 /// \retval false  no byte sent
 bool Uart_handleTx(Uart* const uart);
 
-/// \brief Default interrupt handler for Uart devices.
+/// \brief Default interrupt handler for Uart devices. Handlers are called
+///        after the descriptor lock is released, so they may call Uart
+///        functions, e.g. to start the next transfer.
 /// \param [in] arg Uart device descriptor passed directly to RTEMS interrupt
 ///                  handler
 void Uart_handleInterrupt(Uart* const uart);
 
+#ifdef UART_STATIC_PORTS
+/// \brief Interrupt handlers specialized for each port, built with
+///        UART_STATIC_PORTS for a fixed board layout. The register base of
+///        the port is a compile-time constant, so register accesses do not
+///        go through the descriptor. Uart_startup installs the handler of the
+///        port instead of Uart_handleInterrupt.
+/// \param [in] uart Uart device descriptor of the given port.
+void Uart_handleInterrupt0(Uart* const uart);
+void Uart_handleInterrupt1(Uart* const uart); ///< \copydoc Uart_handleInterrupt0
+void Uart_handleInterrupt2(Uart* const uart); ///< \copydoc Uart_handleInterrupt0
+void Uart_handleInterrupt3(Uart* const uart); ///< \copydoc Uart_handleInterrupt0
+void Uart_handleInterrupt4(Uart* const uart); ///< \copydoc Uart_handleInterrupt0
+void Uart_handleInterrupt5(Uart* const uart); ///< \copydoc Uart_handleInterrupt0
+#endif
+
 /// \brief Checks status register for hardware errors.
 /// \param [in] statusRegister Twihs statrus register value.
 /// \param [out] errFlags Pointer to error flag structure.
@@ -0,0 +1,138 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Byte queue type used by the Uart driver. By default it is ByteFifo,
+///        which requires masking the Uart interrupt vector around every access
+///        made outside of the interrupt handler. Defining UART_USE_SPSC_FIFO
+///        switches the driver to lock-free SpscFifo queues, which a single task
+///        may share with the interrupt handler without any masking.
+
+/**
+ * @defgroup Uart Uart
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_UARTFIFO_H
+#define BSP_UARTFIFO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef UART_USE_SPSC_FIFO
+
+#include <SpscFifo.h>
+
+/// \brief Byte queue used for transmission and reception.
+typedef SpscFifo Uart_Fifo;
+
+#define UART_FIFO_IS_LOCK_FREE 1
+
+static inline bool
+Uart_Fifo_isEmpty(const Uart_Fifo* const fifo)
+{
+    return SpscFifo_isEmpty(fifo);
+}
+
+static inline bool
+Uart_Fifo_isFull(const Uart_Fifo* const fifo)
+{
+    return SpscFifo_isFull(fifo);
+}
+
+static inline uint32_t
+Uart_Fifo_getCapacity(const Uart_Fifo* const fifo)
+{
+    return SpscFifo_getCapacity(fifo);
+}
+
+static inline uint32_t
+Uart_Fifo_getCount(const Uart_Fifo* const fifo)
+{
+    return SpscFifo_getCount(fifo);
+}
+
+static inline bool
+Uart_Fifo_push(Uart_Fifo* const fifo, const uint8_t data)
+{
+    return SpscFifo_push(fifo, data);
+}
+
+static inline bool
+Uart_Fifo_pull(Uart_Fifo* const fifo, uint8_t* const data)
+{
+    return SpscFifo_pull(fifo, data);
+}
+
+#else
+
+#include <ByteFifo.h>
+
+/// \brief Byte queue used for transmission and reception.
+typedef ByteFifo Uart_Fifo;
+
+#define UART_FIFO_IS_LOCK_FREE 0
+
+static inline bool
+Uart_Fifo_isEmpty(const Uart_Fifo* const fifo)
+{
+    return ByteFifo_isEmpty(fifo);
+}
+
+static inline bool
+Uart_Fifo_isFull(const Uart_Fifo* const fifo)
+{
+    return ByteFifo_isFull(fifo);
+}
+
+static inline uint32_t
+Uart_Fifo_getCapacity(const Uart_Fifo* const fifo)
+{
+    return (uint32_t)ByteFifo_getCapacity(fifo);
+}
+
+static inline uint32_t
+Uart_Fifo_getCount(const Uart_Fifo* const fifo)
+{
+    return (uint32_t)ByteFifo_getCount(fifo);
+}
+
+static inline bool
+Uart_Fifo_push(Uart_Fifo* const fifo, const uint8_t data)
+{
+    return ByteFifo_push(fifo, data);
+}
+
+static inline bool
+Uart_Fifo_pull(Uart_Fifo* const fifo, uint8_t* const data)
+{
+    return ByteFifo_pull(fifo, data);
+}
+
+#endif // UART_USE_SPSC_FIFO
+
+#endif // BSP_UARTFIFO_H
+
+/** @} */
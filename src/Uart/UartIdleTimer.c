@@ -0,0 +1,66 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UartIdleTimer.h"
+
+static void
+handleIdleTimeout(volatile void* arg)
+{
+    Uart_handleRxIdleTimeout((Uart*)arg);
+}
+
+static void
+restartApbctrl1(volatile void* timer, const uint32_t timeout)
+{
+    Timer_Apbctrl1* const apbctrl1 = (Timer_Apbctrl1*)timer;
+    // Timer underflows one tick after counting down from the reload value
+    const Timer_Config config = { .isInterruptEnabled = true,
+                                  .isEnabled = false,
+                                  .isAutoReloaded = false,
+                                  .isChained = false,
+                                  .reloadValue = timeout > 0 ? timeout - 1u : 0 };
+
+    Timer_Apbctrl1_setConfigRegisters(apbctrl1, &config);
+    Timer_Apbctrl1_start(apbctrl1);
+}
+
+static void
+stopApbctrl1(volatile void* timer)
+{
+    Timer_Apbctrl1_stop((Timer_Apbctrl1*)timer);
+}
+
+void
+Uart_initApbctrl1IdleTimer(Uart* const uart,
+                           const Timer_Id id,
+                           Timer_Apbctrl1* const timer,
+                           Uart_IdleTimer* const idleTimer)
+{
+    const Timer_InterruptHandler handler = { .callback = handleIdleTimeout, .arg = uart };
+
+    Timer_Apbctrl1_init(id, timer, handler);
+    idleTimer->restart = restartApbctrl1;
+    idleTimer->stop = stopApbctrl1;
+    idleTimer->timer = timer;
+}
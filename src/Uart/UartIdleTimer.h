@@ -0,0 +1,53 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Binding of a GPTIMER as the idle timer of Uart coalescing reception.
+
+/**
+ * @defgroup Uart Uart
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_UART_IDLE_TIMER_H
+#define BSP_UART_IDLE_TIMER_H
+
+#include "Uart.h"
+#include "Timer.h"
+
+/// \brief Initializes an Apbctrl1 timer as a one-shot idle timer of the given
+///        Uart, with its interrupt ending the pending reception burst. Idle
+///        timeout is expressed in ticks of the timer, set by its base scaler.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] id Timer device identifier.
+/// \param [out] timer Timer device descriptor, kept alive while in use.
+/// \param [out] idleTimer Idle timer descriptor to put in Uart_RxBurstHandler.
+void Uart_initApbctrl1IdleTimer(Uart* const uart,
+                                const Timer_Id id,
+                                Timer_Apbctrl1* const timer,
+                                Uart_IdleTimer* const idleTimer);
+
+#endif // BSP_UART_IDLE_TIMER_H
+
+/** @} */
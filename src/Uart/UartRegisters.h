@@ -101,16 +101,24 @@ typedef enum { UART_CONTROL_RE = 0,  // Receiver enable: If set, enables the rec
                UART_CONTROL_TF = 9,  // Transmitter FIFO interrupt enable: When set, Transmitter FIFO level interrupts are enabled.
                UART_CONTROL_RF,      // Receiver FIFO interrupt enable: When set, Receiver FIFO level interrupts are enabled.
                UART_CONTROL_DB,      // FIFO debug mode enable: When set, it is possible to read and write the FIFO debug register.
+               UART_CONTROL_DI = 13, // Delayed interrupt enable: If set, receiver interrupt is delayed until the line is idle (when implemented).
                UART_CONTROL_FA = 31  // FIFOs available: Set to 1, read-only. Receiver and transmitter FIFOs are available.
 } apbuart_control_register_flags;    // Control Register flags definition
 
 #define UART_CLKSCL_OFFSET  0x0Cu
 #define UART_CLKSCL_DIV     8u          // Clock divider value for baud rate generation
-#define UART_CLKSCL_SHIFT   4u          // Byte shift to convert 12-bit clkscl register value to 16-bit
 
 #define UART_SCALER_RELOAD_MASK     0X00000FFF
 #define UART_SCALER_RELOAD_OFFSET   0
 
+#define UART_STATUS_ERROR_MASK      0x00000078u  // BR, OV, PE and FE, cleared by software
+
+#define UART_STATUS_TCNT_MASK       0x03F00000u
+#define UART_STATUS_TCNT_OFFSET     20
+
+#define UART_STATUS_RCNT_MASK       0xFC000000u
+#define UART_STATUS_RCNT_OFFSET     26
+
 #define UART_FIFO_OFFSET    0x10u
 
 #define UART_FLAG_SET 0x01u
@@ -36,6 +36,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 /// \brief Structure representing single queue instance.
 typedef struct
@@ -178,6 +179,85 @@ ByteFifo_pull(ByteFifo* const fifo, uint8_t* const data)
     return true;
 }
 
+/// \brief Returns the total number of bytes the queue can hold.
+/// \param [in] fifo Queue to check.
+/// \returns The capacity of the queue.
+static inline size_t
+ByteFifo_getCapacity(const ByteFifo* const fifo)
+{
+    return (size_t)(fifo->end - fifo->begin);
+}
+
+/// \brief Pushes a block of bytes as last in queue. The data is copied in at
+///        most two contiguous segments, split at the end of the buffer area.
+/// \param [in,out] fifo target queue.
+/// \param [in] data data to push.
+/// \param [in] length number of bytes to push.
+/// \returns The number of bytes pushed, lower than length if queue got full.
+static inline size_t
+ByteFifo_pushBlock(ByteFifo* const fifo,
+                   const uint8_t* const data,
+                   const size_t length)
+{
+    uint8_t* const begin = fifo->begin;
+    uint8_t* const end = fifo->end;
+    uint8_t* const last = fifo->last;
+    const size_t capacity = (size_t)(end - begin);
+    const size_t space = capacity - ByteFifo_getCount(fifo);
+    const size_t total = length < space ? length : space;
+    if(total == 0)
+        return 0;
+
+    const size_t tailSpace = (size_t)(end - last);
+    const size_t firstSegment = total < tailSpace ? total : tailSpace;
+    memcpy(last, data, firstSegment);
+    memcpy(begin, data + firstSegment, total - firstSegment);
+
+    uint8_t* newLast = last + total;
+    if(newLast >= end)
+        newLast -= capacity;
+
+    if(fifo->first == NULL)
+        fifo->first = last;
+    fifo->last = newLast;
+
+    return total;
+}
+
+/// \brief Pulls a block of bytes from queue. Removes pulled items from queue.
+///        The data is copied out in at most two contiguous segments, split at
+///        the end of the buffer area.
+/// \param [in,out] fifo target queue.
+/// \param [out] data address to store pulled data.
+/// \param [in] length maximum number of bytes to pull.
+/// \returns The number of bytes pulled, lower than length if queue got empty.
+static inline size_t
+ByteFifo_pullBlock(ByteFifo* const fifo,
+                   uint8_t* const data,
+                   const size_t length)
+{
+    const size_t count = ByteFifo_getCount(fifo);
+    const size_t total = length < count ? length : count;
+    if(total == 0)
+        return 0;
+
+    uint8_t* const begin = fifo->begin;
+    uint8_t* const end = fifo->end;
+    uint8_t* const first = fifo->first;
+    const size_t tailCount = (size_t)(end - first);
+    const size_t firstSegment = total < tailCount ? total : tailCount;
+    memcpy(data, first, firstSegment);
+    memcpy(data + firstSegment, begin, total - firstSegment);
+
+    uint8_t* newFirst = first + total;
+    if(newFirst >= end)
+        newFirst -= (end - begin);
+
+    fifo->first = (newFirst == fifo->last) ? NULL : newFirst;
+
+    return total;
+}
+
 #endif // UTILS_BYTEFIFO_H
 
 /** @} */
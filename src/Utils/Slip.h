@@ -0,0 +1,155 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Module implementing SLIP (RFC 1055) byte stuffing, one byte at a
+///        time, so that it can run inside interrupt handlers.
+
+/**
+ * @defgroup Slip Slip
+ * @ingroup Utils
+ * @{
+ */
+
+#ifndef UTILS_SLIP_H
+#define UTILS_SLIP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SLIP_END 0xC0u     ///< Frame delimiter.
+#define SLIP_ESC 0xDBu     ///< Escape character.
+#define SLIP_ESC_END 0xDCu ///< Escaped frame delimiter.
+#define SLIP_ESC_ESC 0xDDu ///< Escaped escape character.
+
+/// \brief Structure representing encoder state.
+typedef struct
+{
+    bool hasPending; ///< Second byte of an escape sequence is pending.
+    uint8_t pending; ///< Second byte of an escape sequence.
+} SlipEncoder;
+
+/// \brief Structure representing decoder state.
+typedef struct
+{
+    bool isEscaped; ///< Previous byte was an escape character.
+} SlipDecoder;
+
+/// \brief Result of decoding a single byte.
+typedef enum
+{
+    SlipDecoder_Result_None = 0,     ///< Byte consumed, nothing produced.
+    SlipDecoder_Result_Byte = 1,     ///< Payload byte produced.
+    SlipDecoder_Result_FrameEnd = 2, ///< Frame delimiter received.
+    SlipDecoder_Result_Error = 3,    ///< Invalid escape sequence received.
+} SlipDecoder_Result;
+
+/// \brief Resets encoder, dropping a pending escape sequence.
+/// \param [out] encoder Encoder to reset.
+static inline void
+SlipEncoder_reset(SlipEncoder* const encoder)
+{
+    encoder->hasPending = false;
+    encoder->pending = 0;
+}
+
+/// \brief Encodes a payload byte. Returns the first byte to send, the second
+///        byte of an escape sequence is left pending.
+/// \param [in,out] encoder Encoder state.
+/// \param [in] byte Payload byte.
+/// \returns Byte to send.
+static inline uint8_t
+SlipEncoder_encode(SlipEncoder* const encoder, const uint8_t byte)
+{
+    if (byte == SLIP_END) {
+        encoder->hasPending = true;
+        encoder->pending = SLIP_ESC_END;
+        return SLIP_ESC;
+    }
+    if (byte == SLIP_ESC) {
+        encoder->hasPending = true;
+        encoder->pending = SLIP_ESC_ESC;
+        return SLIP_ESC;
+    }
+    return byte;
+}
+
+/// \brief Pulls the pending second byte of an escape sequence.
+/// \param [in,out] encoder Encoder state.
+/// \param [out] byte Byte to send.
+/// \retval true when a byte was pending.
+/// \retval false otherwise
+static inline bool
+SlipEncoder_pullPending(SlipEncoder* const encoder, uint8_t* const byte)
+{
+    if (!encoder->hasPending) {
+        return false;
+    }
+    encoder->hasPending = false;
+    *byte = encoder->pending;
+    return true;
+}
+
+/// \brief Resets decoder, dropping a pending escape sequence.
+/// \param [out] decoder Decoder to reset.
+static inline void
+SlipDecoder_reset(SlipDecoder* const decoder)
+{
+    decoder->isEscaped = false;
+}
+
+/// \brief Decodes a received byte.
+/// \param [in,out] decoder Decoder state.
+/// \param [in] byte Received byte.
+/// \param [out] payload Payload byte, valid for SlipDecoder_Result_Byte.
+/// \returns Decoding result.
+static inline SlipDecoder_Result
+SlipDecoder_decode(SlipDecoder* const decoder, const uint8_t byte, uint8_t* const payload)
+{
+    if (byte == SLIP_END) {
+        decoder->isEscaped = false;
+        return SlipDecoder_Result_FrameEnd;
+    }
+    if (decoder->isEscaped) {
+        decoder->isEscaped = false;
+        if (byte == SLIP_ESC_END) {
+            *payload = SLIP_END;
+            return SlipDecoder_Result_Byte;
+        }
+        if (byte == SLIP_ESC_ESC) {
+            *payload = SLIP_ESC;
+            return SlipDecoder_Result_Byte;
+        }
+        return SlipDecoder_Result_Error;
+    }
+    if (byte == SLIP_ESC) {
+        decoder->isEscaped = true;
+        return SlipDecoder_Result_None;
+    }
+    *payload = byte;
+    return SlipDecoder_Result_Byte;
+}
+
+#endif // UTILS_SLIP_H
+
+/** @} */
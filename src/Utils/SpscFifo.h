@@ -0,0 +1,237 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ * 
+ * Leon3 BSP for the Test Environment was developed under the project AURORA.
+ * This project has received funding from the European Union’s Horizon 2020
+ * research and innovation programme under grant agreement No 101004291”
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Module representing fixed-size byte queue safe for use by a single
+///        producer and a single consumer (e.g. an interrupt handler and a task)
+///        without any interrupt masking.
+
+/**
+ * @defgroup SpscFifo SpscFifo
+ * @ingroup Utils
+ * @{
+ */
+
+#ifndef UTILS_SPSCFIFO_H
+#define UTILS_SPSCFIFO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/// \brief Structure representing single queue instance. Head is modified only
+///        by the producer and tail only by the consumer. Both indices are
+///        free-running and wrapped with the capacity mask on access.
+typedef struct
+{
+    uint8_t* buffer;        ///< Pointer to buffer area.
+    uint32_t mask;          ///< Capacity of buffer area minus one.
+    volatile uint32_t head; ///< Index of next insert location.
+    volatile uint32_t tail; ///< Index of oldest item in queue.
+} SpscFifo;
+
+/// \brief SpscFifo constructor macro, creates empty queue with given name and
+///        capacity. Capacity has to be a power of two.
+/// \param [in] NAME name of SpscFifo to create.
+/// \param [in] CAPACITY capacity of created SpscFifo.
+// clang-format off
+#define SPSC_FIFO_CREATE(NAME, CAPACITY)                                \
+  uint8_t NAME ## MemoryBlock[(CAPACITY)] = { 0 };                      \
+  SpscFifo NAME = { .buffer = NAME ## MemoryBlock,                      \
+                    .mask   = (CAPACITY) - 1u,                          \
+                    .head   = 0,                                        \
+                    .tail   = 0 }
+// clang-format on
+
+/// \brief SpscFifo initialisation procedure, assigns all fields properly.
+///        Should be called before any use of SpscFifo.
+/// \param [in,out] fifo pointer to SpscFifo to initialise.
+/// \param [in] memoryBlock memory block to be assigned to SpscFifo as its
+///             storage area.
+/// \param [in] memoryBlockSize size of memory block, has to be a power of two.
+/// \retval true on successful initialisation
+/// \retval false otherwise (size is not a power of two)
+static inline bool
+SpscFifo_init(SpscFifo* const fifo,
+              uint8_t* const memoryBlock,
+              const uint32_t memoryBlockSize)
+{
+    if(memoryBlockSize == 0 || (memoryBlockSize & (memoryBlockSize - 1u)) != 0)
+        return false;
+
+    fifo->buffer = memoryBlock;
+    fifo->mask = memoryBlockSize - 1u;
+    fifo->head = 0;
+    fifo->tail = 0;
+    return true;
+}
+
+/// \brief Clears queue. Must not be called while producer or consumer is
+///        active.
+/// \param [in,out] fifo queue to clear.
+static inline void
+SpscFifo_clear(SpscFifo* const fifo)
+{
+    fifo->head = 0;
+    fifo->tail = 0;
+}
+
+/// \brief Returns the total number of bytes the queue can hold.
+/// \param [in] fifo Queue to check.
+/// \returns The capacity of the queue.
+static inline uint32_t
+SpscFifo_getCapacity(const SpscFifo* const fifo)
+{
+    return fifo->mask + 1u;
+}
+
+/// \brief Returns the number of elements in queue. Safe to call from both
+///        sides, the result may be outdated by concurrent push or pull.
+/// \param [in] fifo Queue to check.
+/// \returns The number of elements.
+static inline uint32_t
+SpscFifo_getCount(const SpscFifo* const fifo)
+{
+    const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+    const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+    return head - tail;
+}
+
+/// \brief Checks if queue is full.
+/// \param [in] fifo queue to check.
+/// \retval true when queue is full (next push will not be accepted).
+/// \retval false otherwise
+static inline bool
+SpscFifo_isFull(const SpscFifo* const fifo)
+{
+    return SpscFifo_getCount(fifo) == SpscFifo_getCapacity(fifo);
+}
+
+/// \brief Checks if queue is empty.
+/// \param [in] fifo queue to check.
+/// \retval true when queue is empty (next pull will not be accepted).
+/// \retval false otherwise
+static inline bool
+SpscFifo_isEmpty(const SpscFifo* const fifo)
+{
+    return SpscFifo_getCount(fifo) == 0;
+}
+
+/// \brief Pushes given item as last in queue. May be called by producer only.
+/// \param [in,out] fifo target queue.
+/// \param [in] data data to push.
+/// \retval true on successful push
+/// \retval false otherwise (queue is full)
+static inline bool
+SpscFifo_push(SpscFifo* const fifo, const uint8_t data)
+{
+    const uint32_t head = fifo->head;
+    const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+    if(head - tail > fifo->mask)
+        return false;
+
+    fifo->buffer[head & fifo->mask] = data;
+    __atomic_store_n(&fifo->head, head + 1u, __ATOMIC_RELEASE);
+    return true;
+}
+
+/// \brief Pull first item from queue. Removes pulled item from queue. May be
+///        called by consumer only.
+/// \param [in,out] fifo target queue.
+/// \param [out] data address to store pulled data.
+/// \retval true on successful pull
+/// \retval false otherwise (queue is empty)
+static inline bool
+SpscFifo_pull(SpscFifo* const fifo, uint8_t* const data)
+{
+    const uint32_t tail = fifo->tail;
+    const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+    if(head == tail)
+        return false;
+
+    *data = fifo->buffer[tail & fifo->mask];
+    __atomic_store_n(&fifo->tail, tail + 1u, __ATOMIC_RELEASE);
+    return true;
+}
+
+/// \brief Pushes a block of bytes as last in queue. May be called by producer
+///        only. The data is copied in at most two contiguous segments.
+/// \param [in,out] fifo target queue.
+/// \param [in] data data to push.
+/// \param [in] length number of bytes to push.
+/// \returns The number of bytes pushed, lower than length if queue got full.
+static inline size_t
+SpscFifo_pushBlock(SpscFifo* const fifo,
+                   const uint8_t* const data,
+                   const size_t length)
+{
+    const uint32_t head = fifo->head;
+    const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+    const uint32_t space = SpscFifo_getCapacity(fifo) - (head - tail);
+    const uint32_t total = length < space ? (uint32_t)length : space;
+    if(total == 0)
+        return 0;
+
+    const uint32_t offset = head & fifo->mask;
+    const uint32_t tailSpace = SpscFifo_getCapacity(fifo) - offset;
+    const uint32_t firstSegment = total < tailSpace ? total : tailSpace;
+    memcpy(fifo->buffer + offset, data, firstSegment);
+    memcpy(fifo->buffer, data + firstSegment, total - firstSegment);
+
+    __atomic_store_n(&fifo->head, head + total, __ATOMIC_RELEASE);
+    return total;
+}
+
+/// \brief Pulls a block of bytes from queue. Removes pulled items from queue.
+///        May be called by consumer only. The data is copied out in at most
+///        two contiguous segments.
+/// \param [in,out] fifo target queue.
+/// \param [out] data address to store pulled data.
+/// \param [in] length maximum number of bytes to pull.
+/// \returns The number of bytes pulled, lower than length if queue got empty.
+static inline size_t
+SpscFifo_pullBlock(SpscFifo* const fifo,
+                   uint8_t* const data,
+                   const size_t length)
+{
+    const uint32_t tail = fifo->tail;
+    const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+    const uint32_t count = head - tail;
+    const uint32_t total = length < count ? (uint32_t)length : count;
+    if(total == 0)
+        return 0;
+
+    const uint32_t offset = tail & fifo->mask;
+    const uint32_t tailCount = SpscFifo_getCapacity(fifo) - offset;
+    const uint32_t firstSegment = total < tailCount ? total : tailCount;
+    memcpy(data, fifo->buffer + offset, firstSegment);
+    memcpy(data + firstSegment, fifo->buffer, total - firstSegment);
+
+    __atomic_store_n(&fifo->tail, tail + total, __ATOMIC_RELEASE);
+    return total;
+}
+
+#endif // UTILS_SPSCFIFO_H
+
+/** @} */
@@ -0,0 +1,345 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Run performance benchmarks of the Uart driver.
+///
+/// Results are written through the benchmarked Uart once all measurements
+/// are done, as CSV lines starting with "BENCH,". The first of them is the
+/// header naming the columns.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "SystemConfig.h"
+#include "Uart.h"
+#include <rtems.h>
+#include <rtems/confdefs.h>
+#include <rtems/counter.h>
+
+#define BENCHMARK_LENGTH 64u
+#define LATENCY_ITERATIONS 16u
+#define BENCHMARK_EVENT RTEMS_EVENT_0
+#define BITS_PER_FRAME 10u
+#define TIMEOUT_MARGIN_TICKS 100u
+#define REPORT_TIMEOUT_TICKS 1000u
+#define REPORT_LINE_LENGTH 192u
+
+#ifndef BENCHMARK_CLOCK_FREQUENCY
+/// \brief System clock frequency feeding the Uart scaler, override with
+///        DEFS=-DBENCHMARK_CLOCK_FREQUENCY=<Hz> for other boards
+#define BENCHMARK_CLOCK_FREQUENCY 80000000u
+#endif
+
+#define BAUD_RATE_COUNT (sizeof(baudRates) / sizeof(baudRates[0]))
+#define THROUGHPUT_RESULT_COUNT (BAUD_RATE_COUNT * 4u)
+#define RESULT_COUNT (THROUGHPUT_RESULT_COUNT + 2u)
+
+typedef struct
+{
+    const char* benchmark;
+    const char* mode;
+    uint32_t baudRate;
+    uint32_t bytes;
+    bool isCompleted;
+    uint32_t interrupts;
+    uint64_t isrNanosecondsTotal;
+    uint64_t isrNanosecondsMax;
+    uint64_t elapsedNanoseconds;
+    uint64_t latencyNanosecondsTotal;
+    uint64_t latencyNanosecondsMax;
+    uint32_t latencySamples;
+} BenchmarkResult;
+
+static const uint32_t baudRates[] = {
+    Uart_BaudRate_300,   Uart_BaudRate_600,   Uart_BaudRate_1200,  Uart_BaudRate_1800,  Uart_BaudRate_2400,
+    Uart_BaudRate_4800,  Uart_BaudRate_9600,  Uart_BaudRate_19200, Uart_BaudRate_28800, Uart_BaudRate_38400,
+    Uart_BaudRate_57600, Uart_BaudRate_76800, Uart_BaudRate_115200, Uart_BaudRate_230400, Uart_BaudRate_460800,
+    Uart_BaudRate_921600
+};
+
+static Uart uart0;
+static rtems_interrupt_entry benchmarkInterruptEntry;
+static rtems_id benchmarkTaskId;
+
+static volatile uint32_t interruptCount;
+static volatile uint64_t interruptNanosecondsTotal;
+static volatile rtems_counter_ticks interruptTicksMax;
+static volatile rtems_counter_ticks callbackTimestamp;
+
+static uint8_t payload[BENCHMARK_LENGTH];
+static BenchmarkResult results[RESULT_COUNT];
+
+BYTE_FIFO_CREATE(txByteFifo, BENCHMARK_LENGTH);
+BYTE_FIFO_CREATE(rxByteFifo, BENCHMARK_LENGTH);
+
+static void
+benchmarkInterrupt(void* arg)
+{
+    const rtems_counter_ticks start = rtems_counter_read();
+    Uart_handleInterrupt((Uart*)arg);
+    const rtems_counter_ticks ticks = rtems_counter_difference(rtems_counter_read(), start);
+
+    interruptCount++;
+    interruptNanosecondsTotal += rtems_counter_ticks_to_nanoseconds(ticks);
+    if (ticks > interruptTicksMax) {
+        interruptTicksMax = ticks;
+    }
+}
+
+static void
+emptyCallback(volatile void* arg)
+{
+    (void)arg;
+}
+
+static void
+completionCallback(volatile void* arg)
+{
+    (void)arg;
+    callbackTimestamp = rtems_counter_read();
+    rtems_event_send(benchmarkTaskId, BENCHMARK_EVENT);
+}
+
+static const Uart_TxHandler completionTxHandler = { .callback = completionCallback, .arg = NULL };
+static const Uart_TxHandler idleTxHandler = { .callback = emptyCallback, .arg = NULL };
+
+static void
+startupBenchmarkInterrupt(Uart* const uart)
+{
+    rtems_interrupt_entry_initialize(&benchmarkInterruptEntry, benchmarkInterrupt, uart, "Uart Benchmark");
+    rtems_interrupt_entry_install(Uart0_interrupt, RTEMS_INTERRUPT_UNIQUE, &benchmarkInterruptEntry);
+    rtems_interrupt_vector_enable(Uart0_interrupt);
+}
+
+static void
+shutdownBenchmarkInterrupt(void)
+{
+    rtems_interrupt_vector_disable(Uart0_interrupt);
+    rtems_interrupt_entry_remove(Uart0_interrupt, &benchmarkInterruptEntry);
+}
+
+static void
+resetInterruptStatistics(void)
+{
+    rtems_interrupt_level level;
+    rtems_interrupt_local_disable(level);
+    interruptCount = 0;
+    interruptNanosecondsTotal = 0;
+    interruptTicksMax = 0;
+    rtems_interrupt_local_enable(level);
+}
+
+static void
+configure(Uart* const uart, const uint32_t baudRate, const bool isLoopback, const bool isBulk)
+{
+    Uart_Config config = (Uart_Config){ 0 };
+    config.isTxEnabled = true;
+    config.isRxEnabled = isLoopback;
+    config.isLoopbackModeEnabled = isLoopback;
+    config.isTxBulkModeEnabled = isBulk;
+    config.isRxBulkModeEnabled = isBulk;
+    config.baudRate = baudRate;
+    config.baudRateClkFreq = BENCHMARK_CLOCK_FREQUENCY;
+    Uart_setConfig(uart, &config);
+}
+
+static bool
+waitForCompletion(const uint32_t baudRate, const uint32_t length)
+{
+    const uint32_t lineTicks = (length * BITS_PER_FRAME * rtems_clock_get_ticks_per_second()) / baudRate;
+    rtems_event_set received = 0;
+    return rtems_event_receive(BENCHMARK_EVENT,
+                               RTEMS_WAIT | RTEMS_EVENT_ALL,
+                               2u * lineTicks + TIMEOUT_MARGIN_TICKS,
+                               &received) == RTEMS_SUCCESSFUL;
+}
+
+static void
+clearCompletion(void)
+{
+    rtems_event_set received = 0;
+    rtems_event_receive(BENCHMARK_EVENT, RTEMS_NO_WAIT | RTEMS_EVENT_ANY, RTEMS_NO_TIMEOUT, &received);
+}
+
+static void
+collectInterruptStatistics(BenchmarkResult* const result)
+{
+    result->interrupts = interruptCount;
+    result->isrNanosecondsTotal = interruptNanosecondsTotal;
+    result->isrNanosecondsMax = rtems_counter_ticks_to_nanoseconds(interruptTicksMax);
+}
+
+/// Sends the payload and measures the time until the last byte is handed
+/// to the hardware (Tx) or received back through the loopback (Rx).
+static void
+measureThroughput(Uart* const uart,
+                  const uint32_t baudRate,
+                  const bool isRx,
+                  const bool isBulk,
+                  BenchmarkResult* const result)
+{
+    const Uart_RxHandler rxHandler = { .lengthCallback = completionCallback,
+                                       .characterCallback = emptyCallback,
+                                       .lengthArg = NULL,
+                                       .characterArg = NULL,
+                                       .targetCharacter = '\0',
+                                       .targetLength = BENCHMARK_LENGTH };
+
+    configure(uart, baudRate, isRx, isBulk);
+    ByteFifo_clear(&txByteFifo);
+    ByteFifo_clear(&rxByteFifo);
+    ByteFifo_pushBlock(&txByteFifo, payload, sizeof(payload));
+    uart->interruptData.sentBytes = 0;
+    if (isRx) {
+        Uart_readAsync(uart, &rxByteFifo, rxHandler);
+    }
+    clearCompletion();
+    resetInterruptStatistics();
+
+    const rtems_counter_ticks start = rtems_counter_read();
+    Uart_writeAsync(uart, &txByteFifo, isRx ? idleTxHandler : completionTxHandler);
+    result->isCompleted = waitForCompletion(baudRate, BENCHMARK_LENGTH);
+    result->elapsedNanoseconds = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(callbackTimestamp, start));
+    collectInterruptStatistics(result);
+
+    result->benchmark = isRx ? "rx_throughput" : "tx_throughput";
+    result->mode = isBulk ? "bulk" : "byte";
+    result->baudRate = baudRate;
+    result->bytes = BENCHMARK_LENGTH;
+
+    Uart_readAsync(uart, NULL, rxHandler);
+}
+
+/// Measures time from Uart_writeAsync call to the end-of-transmission
+/// callback for single byte writes.
+static void
+measureLatency(Uart* const uart, const uint32_t baudRate, const bool isBulk, BenchmarkResult* const result)
+{
+    configure(uart, baudRate, false, isBulk);
+    memset(result, 0, sizeof(*result));
+    result->isCompleted = true;
+    resetInterruptStatistics();
+
+    for (uint32_t i = 0; i < LATENCY_ITERATIONS; i++) {
+        ByteFifo_clear(&txByteFifo);
+        ByteFifo_push(&txByteFifo, payload[i]);
+        clearCompletion();
+
+        const rtems_counter_ticks start = rtems_counter_read();
+        Uart_writeAsync(uart, &txByteFifo, completionTxHandler);
+        if (!waitForCompletion(baudRate, 1)) {
+            result->isCompleted = false;
+            break;
+        }
+        const uint64_t latency = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(callbackTimestamp, start));
+        result->latencyNanosecondsTotal += latency;
+        if (latency > result->latencyNanosecondsMax) {
+            result->latencyNanosecondsMax = latency;
+        }
+        result->latencySamples++;
+    }
+    collectInterruptStatistics(result);
+
+    result->benchmark = "write_latency";
+    result->mode = isBulk ? "bulk" : "byte";
+    result->baudRate = baudRate;
+    result->bytes = result->latencySamples;
+}
+
+static bool
+printLine(Uart* const uart, const char* const line)
+{
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    return Uart_writeBuffer(uart, (const uint8_t*)line, strlen(line), REPORT_TIMEOUT_TICKS, &errCode);
+}
+
+static bool
+printResult(Uart* const uart, const BenchmarkResult* const result)
+{
+    char line[REPORT_LINE_LENGTH];
+    const uint32_t interrupts = result->interrupts;
+    const uint32_t latencySamples = result->latencySamples;
+
+    snprintf(line,
+             sizeof(line),
+             "BENCH,%s,%s,%lu,%lu,%d,%lu,%lu,%llu,%llu,%llu,%llu,%llu\n",
+             result->benchmark,
+             result->mode,
+             (unsigned long)result->baudRate,
+             (unsigned long)result->bytes,
+             result->isCompleted ? 1 : 0,
+             (unsigned long)interrupts,
+             (unsigned long)(result->bytes > 0 ? interrupts * 1000u / result->bytes : 0),
+             (unsigned long long)(interrupts > 0 ? result->isrNanosecondsTotal / interrupts : 0),
+             (unsigned long long)result->isrNanosecondsMax,
+             (unsigned long long)(result->elapsedNanoseconds > 0
+                                      ? (uint64_t)result->bytes * 1000000000u / result->elapsedNanoseconds
+                                      : 0),
+             (unsigned long long)(latencySamples > 0 ? result->latencyNanosecondsTotal / latencySamples : 0),
+             (unsigned long long)result->latencyNanosecondsMax);
+    return printLine(uart, line);
+}
+
+bool
+benchmark_Uart(Uart* uart)
+{
+    bool result = true;
+
+    for (uint32_t i = 0; i < sizeof(payload); i++) {
+        payload[i] = (uint8_t)('0' + (i % 10u));
+    }
+
+    Uart_init(Uart_Id_0, uart);
+    benchmarkTaskId = rtems_task_self();
+    startupBenchmarkInterrupt(uart);
+
+    for (uint32_t i = 0; i < BAUD_RATE_COUNT; i++) {
+        measureThroughput(uart, baudRates[i], false, false, &results[4u * i]);
+        measureThroughput(uart, baudRates[i], false, true, &results[4u * i + 1u]);
+        measureThroughput(uart, baudRates[i], true, false, &results[4u * i + 2u]);
+        measureThroughput(uart, baudRates[i], true, true, &results[4u * i + 3u]);
+    }
+    measureLatency(uart, Uart_BaudRate_115200, false, &results[THROUGHPUT_RESULT_COUNT]);
+    measureLatency(uart, Uart_BaudRate_115200, true, &results[THROUGHPUT_RESULT_COUNT + 1u]);
+
+    configure(uart, Uart_BaudRate_115200, false, false);
+    result = printLine(uart, "\nBENCH,benchmark,mode,baud,bytes,completed,interrupts,interrupts_per_byte_x1000,"
+                             "isr_ns_avg,isr_ns_max,bytes_per_s,latency_ns_avg,latency_ns_max\n");
+    for (uint32_t i = 0; i < RESULT_COUNT && result; i++) {
+        result = printResult(uart, &results[i]);
+    }
+    if (result) {
+        result = printLine(uart, "Success\n");
+    }
+
+    shutdownBenchmarkInterrupt();
+    Uart_shutdown(uart);
+
+    return result;
+}
+
+rtems_task
+Init(rtems_task_argument arg)
+{
+    (void)arg;
+    rtems_fatal(RTEMS_FATAL_SOURCE_EXIT, benchmark_Uart(&uart0));
+}
+
+/** @} */
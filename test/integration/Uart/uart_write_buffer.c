@@ -0,0 +1,65 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Run functionality tests
+
+#include <stdbool.h>
+#include <string.h>
+#include "SystemConfig.h"
+#include "Uart.h"
+#include <rtems.h>
+#include <rtems/confdefs.h>
+#include <rtems/bspIo.h>
+
+#define WRITE_TIMEOUT_TICKS 1000
+
+static Uart uart0;
+
+static const uint8_t data[] = "Write text (blocking)\r\n";
+static const uint8_t success[] = "Success\n";
+
+bool
+test_Uart_writeBuffer(Uart* uart)
+{
+    bool result = false;
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+
+    Uart_init(Uart_Id_0, uart);
+    Uart_Config config = (Uart_Config){0};
+    config.isTxEnabled = true;
+    config.isRxEnabled = true;
+    Uart_setConfig(uart, &config);
+    Uart_startup(uart);
+    if (Uart_writeBuffer(uart, data, sizeof(data) - 1, WRITE_TIMEOUT_TICKS, &errCode)) {
+        result = Uart_writeBuffer(uart, success, sizeof(success) - 1, WRITE_TIMEOUT_TICKS, &errCode);
+    }
+    Uart_shutdown(uart);
+
+    return result;
+}
+
+rtems_task
+Init(rtems_task_argument arg)
+{
+    (void)arg;
+    rtems_fatal(RTEMS_FATAL_SOURCE_EXIT, test_Uart_writeBuffer(&uart0));
+}
+
+/** @} */
@@ -0,0 +1,115 @@
+#include "CppUTest/TestHarness.h"
+
+#include <stdint.h>
+
+extern "C" {
+#include "Timer_private.h"
+#include "TimerCapture.h"
+}
+
+#define TEST_CAPTURE_CAPACITY 4u
+
+TEST_GROUP(TimerCaptureTests)
+{
+    Timer_Capture capture;
+    Timer_Apbctrl2 timer;
+    Timer_CaptureEvent events[TEST_CAPTURE_CAPACITY];
+
+    void setup() {
+        timer.base = NULL;
+        CHECK_TRUE(Timer_Capture_init(&capture, Timer_Id_1, &timer, events, TEST_CAPTURE_CAPACITY));
+    }
+
+    // Emulates the hardware latching the counter, which disables latching
+    bool latch(const uint32_t elapsedTicks) {
+        timer.regs->latch = 0xFFFFFFFFu - elapsedTicks;
+        Timer_setFlag(&timer.base->configuration, TIMER_FLAG_RESET, TIMER_CONFIG_EL);
+        return Timer_Capture_handleEvent(&capture);
+    }
+};
+
+TEST(TimerCaptureTests, Timer_Capture_init_shouldRejectCapacityNotBeingPowerOfTwo)
+{
+    CHECK_FALSE(Timer_Capture_init(&capture, Timer_Id_1, &timer, events, 0));
+    CHECK_FALSE(Timer_Capture_init(&capture, Timer_Id_1, &timer, events, 3u));
+}
+
+TEST(TimerCaptureTests, Timer_Capture_start_shouldStartFreeRunningTimebaseAndEnableLatching)
+{
+    Timer_Config config;
+
+    Timer_Capture_start(&capture, (1u << 5u) | (1u << 12u));
+    Timer_Apbctrl2_getConfigRegisters(&timer, &config);
+
+    CHECK_TRUE(config.isEnabled);
+    CHECK_TRUE(config.isAutoReloaded);
+    CHECK_FALSE(config.isInterruptEnabled);
+    CHECK_EQUAL(0xFFFFFFFFu, config.reloadValue);
+    CHECK_EQUAL((1u << 5u) | (1u << 12u), timer.base->latchConfiguration);
+    CHECK_TRUE(Timer_getFlag(timer.base->configuration, TIMER_CONFIG_EL));
+
+    Timer_Capture_stop(&capture);
+    CHECK_EQUAL(0u, timer.base->latchConfiguration);
+    CHECK_FALSE(Timer_getFlag(timer.base->configuration, TIMER_CONFIG_EL));
+    CHECK_FALSE(Timer_getFlag(timer.regs->control, TIMER_CONTROL_EN));
+}
+
+TEST(TimerCaptureTests, Timer_Capture_handleEvent_shouldRecordTimestampsAndDeltasAndRearmLatching)
+{
+    Timer_CaptureEvent event;
+
+    Timer_Capture_start(&capture, 1u << 5u);
+    CHECK_FALSE(Timer_Capture_read(&capture, &event));
+
+    CHECK_TRUE(latch(1000u));
+    CHECK_TRUE(Timer_getFlag(timer.base->configuration, TIMER_CONFIG_EL));
+    CHECK_TRUE(latch(41000u));
+    CHECK_EQUAL(2u, Timer_Capture_getCount(&capture));
+
+    CHECK_TRUE(Timer_Capture_read(&capture, &event));
+    CHECK_EQUAL(1000u, event.timestamp);
+    CHECK_EQUAL(0u, event.delta);
+    CHECK_TRUE(Timer_Capture_read(&capture, &event));
+    CHECK_EQUAL(41000u, event.timestamp);
+    CHECK_EQUAL(40000u, event.delta);
+    CHECK_FALSE(Timer_Capture_read(&capture, &event));
+}
+
+TEST(TimerCaptureTests, Timer_Capture_handleEvent_shouldComputeDeltaAcrossCounterWrap)
+{
+    Timer_CaptureEvent event;
+
+    Timer_Capture_start(&capture, 1u << 5u);
+    CHECK_TRUE(latch(0xFFFFFF00u));
+    timer.regs->latch = 0xFFFFFFFFu - 0x100u + 1u;
+    CHECK_TRUE(Timer_Capture_handleEvent(&capture));
+
+    CHECK_TRUE(Timer_Capture_read(&capture, &event));
+    CHECK_TRUE(Timer_Capture_read(&capture, &event));
+    CHECK_EQUAL(0xFFu, event.timestamp);
+    CHECK_EQUAL(0x1FFu, event.delta);
+}
+
+TEST(TimerCaptureTests, Timer_Capture_handleEvent_shouldCountOverrunsOnFullRingAndMeasureDeltasBetweenStoredEvents)
+{
+    Timer_CaptureEvent event;
+
+    Timer_Capture_start(&capture, 1u << 5u);
+    for (uint32_t i = 0; i < TEST_CAPTURE_CAPACITY; i++) {
+        CHECK_TRUE(latch(100u * (i + 1u)));
+    }
+    CHECK_FALSE(latch(500u));
+    CHECK_EQUAL(1u, Timer_Capture_getOverrunCount(&capture));
+
+    CHECK_TRUE(Timer_Capture_read(&capture, &event));
+    CHECK_TRUE(latch(650u));
+    for (uint32_t i = 0; i < TEST_CAPTURE_CAPACITY; i++) {
+        CHECK_TRUE(Timer_Capture_read(&capture, &event));
+    }
+    CHECK_EQUAL(650u, event.timestamp);
+    CHECK_EQUAL(250u, event.delta);
+
+    Timer_Capture_start(&capture, 1u << 5u);
+    CHECK_EQUAL(0u, Timer_Capture_getOverrunCount(&capture));
+    CHECK_EQUAL(0u, Timer_Capture_getCount(&capture));
+}
@@ -0,0 +1,93 @@
+#include "CppUTest/TestHarness.h"
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+#include "Timer_private.h"
+#include "TimerClock.h"
+}
+
+TEST_GROUP(TimerClockTests)
+{
+    Timer_Clock clock;
+
+    void setup() {
+        memset(&clock, 0, sizeof(clock));
+    }
+};
+
+TEST(TimerClockTests, Timer_Clock_init_shouldRejectTimersWithoutChainedSuccessor)
+{
+    CHECK_FALSE(Timer_Clock_init(&clock, Timer_Id_0, 1000000u));
+    CHECK_FALSE(Timer_Clock_init(&clock, Timer_Id_4, 1000000u));
+    CHECK_FALSE(Timer_Clock_init(&clock, Timer_Id_1, 0));
+    CHECK_TRUE(Timer_Clock_init(&clock, Timer_Id_2, 1000000u));
+    CHECK_EQUAL(Timer_Id_2, clock.low.id);
+    CHECK_EQUAL(Timer_Id_3, clock.high.id);
+    POINTERS_EQUAL(clock.low.base, clock.high.base);
+}
+
+TEST(TimerClockTests, Timer_Clock_start_shouldChainHighTimerAndReloadBothCounters)
+{
+    Timer_Config config;
+
+    CHECK_TRUE(Timer_Clock_init(&clock, Timer_Id_1, 1000000u));
+    Timer_Clock_start(&clock);
+
+    Timer_Apbctrl1_getConfigRegisters(&clock.low, &config);
+    CHECK_TRUE(config.isEnabled);
+    CHECK_TRUE(config.isAutoReloaded);
+    CHECK_FALSE(config.isChained);
+    CHECK_FALSE(config.isInterruptEnabled);
+    CHECK_EQUAL(0xFFFFFFFFu, config.reloadValue);
+    CHECK_TRUE(Timer_getFlag(clock.low.regs->control, TIMER_CONTROL_LD));
+
+    Timer_Apbctrl1_getConfigRegisters(&clock.high, &config);
+    CHECK_TRUE(config.isEnabled);
+    CHECK_TRUE(config.isAutoReloaded);
+    CHECK_TRUE(config.isChained);
+    CHECK_FALSE(config.isInterruptEnabled);
+    CHECK_EQUAL(0xFFFFFFFFu, config.reloadValue);
+    CHECK_TRUE(Timer_getFlag(clock.high.regs->control, TIMER_CONTROL_LD));
+}
+
+TEST(TimerClockTests, Timer_Clock_getTicks_shouldCombineBothDownCountersIntoElapsedTicks)
+{
+    CHECK_TRUE(Timer_Clock_init(&clock, Timer_Id_1, 1000000u));
+
+    clock.high.regs->counter = 0xFFFFFFFFu;
+    clock.low.regs->counter = 0xFFFFFFFFu;
+    CHECK_EQUAL(0u, Timer_Clock_getTicks(&clock));
+
+    clock.low.regs->counter = 0xFFFFFF00u;
+    CHECK_EQUAL(0xFFu, Timer_Clock_getTicks(&clock));
+
+    // Counter after the low timer underflowed three times
+    clock.high.regs->counter = 0xFFFFFFFCu;
+    clock.low.regs->counter = 0xFFFFFFFFu;
+    CHECK_EQUAL(0x300000000ull, Timer_Clock_getTicks(&clock));
+}
+
+TEST(TimerClockTests, Timer_Clock_ticksToNanoseconds_shouldConvertWholeAndFractionalTickLengths)
+{
+    CHECK_TRUE(Timer_Clock_init(&clock, Timer_Id_1, 1000000u));
+    CHECK_EQUAL(1000u, clock.nanosecondsPerTick);
+    CHECK_EQUAL(5000000000000ull, Timer_Clock_ticksToNanoseconds(&clock, 5000000000ull));
+
+    CHECK_TRUE(Timer_Clock_init(&clock, Timer_Id_1, 3000000u));
+    CHECK_EQUAL(0u, clock.nanosecondsPerTick);
+    CHECK_EQUAL(333u, Timer_Clock_ticksToNanoseconds(&clock, 1u));
+    CHECK_EQUAL(1000000000u, Timer_Clock_ticksToNanoseconds(&clock, 3000000u));
+    // Ticks times 10^9 would overflow 64 bits here
+    CHECK_EQUAL(6148914691236517000ull, Timer_Clock_ticksToNanoseconds(&clock, 0xFFFFFFFFFFFFFFFFull / 1000u));
+}
+
+TEST(TimerClockTests, Timer_Clock_getNanoseconds_shouldConvertElapsedTicks)
+{
+    CHECK_TRUE(Timer_Clock_init(&clock, Timer_Id_1, 40000000u));
+    clock.high.regs->counter = 0xFFFFFFFFu;
+    clock.low.regs->counter = 0xFFFFFFFFu - 40000000u;
+
+    CHECK_EQUAL(1000000000u, Timer_Clock_getNanoseconds(&clock));
+}
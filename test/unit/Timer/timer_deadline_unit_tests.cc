@@ -0,0 +1,244 @@
+#include "CppUTest/TestHarness.h"
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+#include "Timer_private.h"
+#include "TimerDeadline.h"
+}
+
+#define TEST_DEADLINE_COUNT 4u
+
+typedef struct
+{
+    Timer_DeadlineScheduler* scheduler;
+    Timer_Deadline* deadline;
+    uint64_t firedAt;
+    uint32_t firedCount;
+    uint64_t period;
+    bool isFixedRate;
+} TestExpiry;
+
+static void
+recordExpiry(volatile void* arg)
+{
+    TestExpiry* const expiry = (TestExpiry*)arg;
+    expiry->firedAt = Timer_DeadlineScheduler_getTime(expiry->scheduler);
+    expiry->firedCount++;
+    if (expiry->period > 0 && expiry->isFixedRate) {
+        Timer_DeadlineScheduler_scheduleAt(expiry->scheduler, expiry->deadline, expiry->deadline->expiry + expiry->period);
+    } else if (expiry->period > 0) {
+        Timer_DeadlineScheduler_schedule(expiry->scheduler, expiry->deadline, expiry->period);
+    }
+}
+
+TEST_GROUP(TimerDeadlineTests)
+{
+    Timer_DeadlineScheduler scheduler;
+    Timer_Apbctrl1 timer;
+    Timer_Clock clock;
+    uint64_t now;
+    Timer_Deadline deadlines[TEST_DEADLINE_COUNT];
+    TestExpiry expiries[TEST_DEADLINE_COUNT];
+
+    void setup() {
+        clock.low.base = NULL;
+        Timer_Clock_init(&clock, Timer_Id_2, 1000000u);
+        Timer_Clock_start(&clock);
+        setTime(0);
+        Timer_DeadlineScheduler_init(&scheduler, Timer_Id_1, &timer, &clock);
+        memset(expiries, 0, sizeof(expiries));
+        for (uint32_t i = 0; i < TEST_DEADLINE_COUNT; i++) {
+            expiries[i].scheduler = &scheduler;
+            expiries[i].deadline = &deadlines[i];
+            const Timer_InterruptHandler handler = { .callback = recordExpiry, .arg = &expiries[i] };
+            Timer_DeadlineScheduler_initDeadline(&deadlines[i], handler);
+        }
+    }
+
+    // Sets the down-counters of the clock to an elapsed tick count
+    void setTime(const uint64_t time) {
+        now = time;
+        clock.high.regs->counter = ~(uint32_t)(time >> 32u);
+        clock.low.regs->counter = ~(uint32_t)time;
+    }
+
+    // Emulates the hardware loading the reload value on start
+    void load() {
+        timer.regs->counter = timer.regs->reload;
+    }
+
+    void elapse(const uint32_t ticks) {
+        setTime(now + ticks);
+        timer.regs->counter -= ticks;
+    }
+
+    // Emulates underflow of the one-shot timer and its interrupt, handled
+    // latency ticks later
+    uint32_t expire(const uint32_t latency = 0) {
+        setTime(now + timer.regs->counter + 1u + latency);
+        timer.regs->counter = TIMER_UNDERFLOWED;
+        Timer_setFlag(&timer.regs->control, TIMER_FLAG_RESET, TIMER_CONTROL_EN);
+        const uint32_t dispatched = Timer_DeadlineScheduler_handleExpiry(&scheduler);
+        load();
+        return dispatched;
+    }
+
+    bool isArmed() {
+        return Timer_getFlag(timer.regs->control, TIMER_CONTROL_EN);
+    }
+};
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_schedule_shouldArmOneShotTimerWithTimeout)
+{
+    Timer_Config config;
+
+    CHECK_FALSE(isArmed());
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 1000u);
+    Timer_Apbctrl1_getConfigRegisters(&timer, &config);
+
+    CHECK_TRUE(config.isEnabled);
+    CHECK_TRUE(config.isInterruptEnabled);
+    CHECK_FALSE(config.isAutoReloaded);
+    CHECK_FALSE(config.isChained);
+    CHECK_EQUAL(999u, config.reloadValue);
+
+    load();
+    elapse(400u);
+    CHECK_EQUAL(400u, Timer_DeadlineScheduler_getTime(&scheduler));
+    CHECK_EQUAL(1u, expire());
+    CHECK_EQUAL(1000u, expiries[0].firedAt);
+    CHECK_FALSE(Timer_DeadlineScheduler_isPending(&deadlines[0]));
+    CHECK_FALSE(isArmed());
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_schedule_shouldReprogramOnlyForEarlierDeadline)
+{
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 1000u);
+    load();
+    elapse(100u);
+
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[1], 2000u);
+    CHECK_EQUAL(999u, timer.regs->reload);
+
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[2], 300u);
+    CHECK_EQUAL(299u, timer.regs->reload);
+    load();
+
+    CHECK_EQUAL(1u, expire());
+    CHECK_EQUAL(400u, expiries[2].firedAt);
+    CHECK_EQUAL(599u, timer.regs->reload);
+    CHECK_EQUAL(1u, expire());
+    CHECK_EQUAL(1000u, expiries[0].firedAt);
+    CHECK_EQUAL(1099u, timer.regs->reload);
+    CHECK_EQUAL(1u, expire());
+    CHECK_EQUAL(2100u, expiries[1].firedAt);
+    CHECK_FALSE(isArmed());
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_handleExpiry_shouldDispatchAllDueDeadlinesInOneInterrupt)
+{
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 50u);
+    load();
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[1], 50u);
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[2], 50u);
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[3], 51u);
+
+    CHECK_EQUAL(3u, expire());
+    CHECK_EQUAL(0u, timer.regs->reload);
+    CHECK_EQUAL(1u, expire());
+    CHECK_EQUAL(51u, expiries[3].firedAt);
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_handleExpiry_shouldRearmInStepsForDeadlinesBeyondCounterRange)
+{
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 0x100000010ull);
+    CHECK_EQUAL(0xFFFFFFFEu, timer.regs->reload);
+    load();
+
+    CHECK_EQUAL(0u, expire());
+    CHECK_TRUE(isArmed());
+    CHECK_EQUAL(0x10u, timer.regs->reload);
+    CHECK_EQUAL(1u, expire());
+    CHECK_EQUAL(0x100000010ull, expiries[0].firedAt);
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_handleExpiry_shouldAllowCallbackToRescheduleItsDeadline)
+{
+    expiries[0].period = 250u;
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 250u);
+    load();
+
+    for (uint32_t i = 0; i < 10u; i++) {
+        CHECK_EQUAL(1u, expire());
+    }
+
+    CHECK_EQUAL(10u, expiries[0].firedCount);
+    CHECK_EQUAL(2500u, expiries[0].firedAt);
+    CHECK_TRUE(isArmed());
+    CHECK_EQUAL(249u, timer.regs->reload);
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_scheduleAt_shouldKeepFixedRateDespiteInterruptLatency)
+{
+    expiries[0].period = 250u;
+    expiries[0].isFixedRate = true;
+    Timer_DeadlineScheduler_scheduleAt(&scheduler, &deadlines[0], 250u);
+    CHECK_EQUAL(249u, timer.regs->reload);
+    load();
+
+    for (uint32_t i = 1; i <= 10u; i++) {
+        CHECK_EQUAL(1u, expire(7u));
+        CHECK_EQUAL(i * 250u + 7u, expiries[0].firedAt);
+        CHECK_EQUAL((i + 1u) * 250u, deadlines[0].expiry);
+        CHECK_EQUAL(242u, timer.regs->reload);
+    }
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_getTime_shouldKeepCountingWhileIdle)
+{
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 100u);
+    load();
+    CHECK_EQUAL(1u, expire(5u));
+    CHECK_FALSE(isArmed());
+
+    elapse(500u);
+    CHECK_EQUAL(605u, Timer_DeadlineScheduler_getTime(&scheduler));
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[1], 100u);
+    CHECK_EQUAL(99u, timer.regs->reload);
+    load();
+    CHECK_EQUAL(1u, expire());
+    CHECK_EQUAL(705u, expiries[1].firedAt);
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_cancel_shouldStopTimerWhenNoDeadlineIsLeft)
+{
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 100u);
+    load();
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[1], 200u);
+    elapse(30u);
+
+    CHECK_TRUE(Timer_DeadlineScheduler_cancel(&scheduler, &deadlines[0]));
+    CHECK_FALSE(Timer_DeadlineScheduler_cancel(&scheduler, &deadlines[0]));
+    CHECK_TRUE(isArmed());
+    CHECK_EQUAL(0u, expire());
+    CHECK_EQUAL(99u, timer.regs->reload);
+
+    elapse(10u);
+    CHECK_TRUE(Timer_DeadlineScheduler_cancel(&scheduler, &deadlines[1]));
+    CHECK_FALSE(isArmed());
+    CHECK_EQUAL(110u, Timer_DeadlineScheduler_getTime(&scheduler));
+    CHECK_EQUAL(0u, expiries[0].firedCount);
+    CHECK_EQUAL(0u, expiries[1].firedCount);
+}
+
+TEST(TimerDeadlineTests, Timer_DeadlineScheduler_handleExpiry_shouldIgnoreStaleInterrupt)
+{
+    Timer_DeadlineScheduler_schedule(&scheduler, &deadlines[0], 100u);
+    load();
+
+    CHECK_EQUAL(0u, Timer_DeadlineScheduler_handleExpiry(&scheduler));
+    CHECK_TRUE(Timer_DeadlineScheduler_isPending(&deadlines[0]));
+    CHECK_EQUAL(1u, expire());
+}
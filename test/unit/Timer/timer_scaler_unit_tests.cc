@@ -0,0 +1,119 @@
+#include "CppUTest/TestHarness.h"
+
+#include <stdint.h>
+
+extern "C" {
+#include "TimerScaler.h"
+}
+
+#define TEST_CLOCK_FREQUENCY 80000000u
+
+TEST_GROUP(TimerScalerTests)
+{
+    Timer_PeriodSetting settings[4];
+    uint16_t apbctrl1Scaler;
+    uint8_t apbctrl2Scaler;
+
+    void setup() {
+        apbctrl1Scaler = 0;
+        apbctrl2Scaler = 0;
+    }
+};
+
+TEST(TimerScalerTests, Timer_computePeriodSettings_shouldChooseSmallestScalerGivingExactPeriods)
+{
+    const Timer_PeriodRequest requests[] = { { .periodNs = 0, .frequencyHz = 1000u },
+                                             { .periodNs = 3000u, .frequencyHz = 0 } };
+
+    CHECK_TRUE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, requests, 2u, 0, &apbctrl1Scaler, settings));
+
+    CHECK_EQUAL(7u, apbctrl1Scaler);
+    CHECK_EQUAL(9999u, settings[0].reloadValue);
+    CHECK_EQUAL(1000000u, settings[0].achievedPeriodNs);
+    CHECK_EQUAL(0, settings[0].errorPpm);
+    CHECK_EQUAL(29u, settings[1].reloadValue);
+    CHECK_EQUAL(3000u, settings[1].achievedPeriodNs);
+    CHECK_EQUAL(0, settings[1].errorPpm);
+}
+
+TEST(TimerScalerTests, Timer_computePeriodSettings_shouldRaiseScalerToFitLongPeriodInReloadRegister)
+{
+    const Timer_PeriodRequest requests[] = { { .periodNs = 3600000000000ull, .frequencyHz = 0 } };
+
+    CHECK_TRUE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, requests, 1u, 0, &apbctrl1Scaler, settings));
+
+    // Smallest scaler fitting the reload register is within 0.1 ppb
+    CHECK_EQUAL(67u, apbctrl1Scaler);
+    CHECK_EQUAL(4235294117u, settings[0].reloadValue);
+    CHECK_EQUAL(3600000000300ull, settings[0].achievedPeriodNs);
+    CHECK_EQUAL(0, settings[0].errorPpm);
+}
+
+TEST(TimerScalerTests, Timer_computePeriodSettings_shouldReportErrorAndRejectItAboveLimit)
+{
+    const Timer_PeriodRequest requests[] = { { .periodNs = 75u, .frequencyHz = 0 },
+                                             { .periodNs = 1000000u, .frequencyHz = 0 } };
+
+    CHECK_FALSE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, requests, 2u, 10u, &apbctrl1Scaler, settings));
+    CHECK_EQUAL(0u, apbctrl1Scaler);
+
+    CHECK_TRUE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, requests, 2u, 30u, &apbctrl1Scaler, settings));
+    CHECK_EQUAL(5u, apbctrl1Scaler);
+    CHECK_EQUAL(0u, settings[0].reloadValue);
+    CHECK_EQUAL(0, settings[0].errorPpm);
+    CHECK_EQUAL(13332u, settings[1].reloadValue);
+    CHECK_EQUAL(999975u, settings[1].achievedPeriodNs);
+    CHECK_EQUAL(-25, settings[1].errorPpm);
+}
+
+TEST(TimerScalerTests, Timer_computePeriodSettings_shouldRejectPeriodsOutsideScalerAndReloadRange)
+{
+    const Timer_PeriodRequest tooLong[] = { { .periodNs = 36000000000000ull, .frequencyHz = 0 } };
+    const Timer_PeriodRequest tooShort[] = { { .periodNs = 10u, .frequencyHz = 0 } };
+    const Timer_PeriodRequest empty[] = { { .periodNs = 0, .frequencyHz = 0 } };
+    const Timer_PeriodRequest overflowing[] = { { .periodNs = UINT64_MAX, .frequencyHz = 0 } };
+
+    CHECK_FALSE(Timer_Apbctrl2_computePeriodSettings(TEST_CLOCK_FREQUENCY, tooLong, 1u, 0, &apbctrl2Scaler, settings));
+    CHECK_TRUE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, tooLong, 1u, 0, &apbctrl1Scaler, settings));
+    CHECK_FALSE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, tooShort, 1u, 1000000u, &apbctrl1Scaler, settings));
+    CHECK_FALSE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, empty, 1u, 0, &apbctrl1Scaler, settings));
+    CHECK_FALSE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, overflowing, 1u, 0, &apbctrl1Scaler, settings));
+    CHECK_FALSE(Timer_Apbctrl1_computePeriodSettings(0, tooLong, 1u, 0, &apbctrl1Scaler, settings));
+    CHECK_FALSE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, tooLong, 0, 0, &apbctrl1Scaler, settings));
+}
+
+TEST(TimerScalerTests, Timer_applyPeriodSettings_shouldSetSharedScalerAndReloadsKeepingFlags)
+{
+    Timer_Apbctrl1 first;
+    Timer_Apbctrl1 second;
+    Timer_Apbctrl1* const timers[] = { &first, &second };
+    const Timer_Config config = { .isInterruptEnabled = true,
+                                  .isEnabled = true,
+                                  .isAutoReloaded = true,
+                                  .isChained = false,
+                                  .reloadValue = 1u };
+    const Timer_PeriodRequest requests[] = { { .periodNs = 0, .frequencyHz = 1000u },
+                                             { .periodNs = 0, .frequencyHz = 40u } };
+    Timer_Config applied;
+
+    first.base = NULL;
+    Timer_Apbctrl1_init(Timer_Id_1, &first, defaultInterruptHandler);
+    second.base = first.base;
+    Timer_Apbctrl1_init(Timer_Id_2, &second, defaultInterruptHandler);
+    Timer_Apbctrl1_setConfigRegisters(&first, &config);
+    Timer_Apbctrl1_setConfigRegisters(&second, &config);
+
+    CHECK_TRUE(Timer_Apbctrl1_computePeriodSettings(TEST_CLOCK_FREQUENCY, requests, 2u, 0, &apbctrl1Scaler, settings));
+    Timer_Apbctrl1_applyPeriodSettings(timers, 2u, apbctrl1Scaler, settings);
+
+    CHECK_EQUAL(apbctrl1Scaler, first.base->reload);
+    CHECK_EQUAL(apbctrl1Scaler, first.base->scaler);
+    Timer_Apbctrl1_getConfigRegisters(&first, &applied);
+    CHECK_TRUE(applied.isEnabled);
+    CHECK_TRUE(applied.isInterruptEnabled);
+    CHECK_EQUAL(settings[0].reloadValue, applied.reloadValue);
+    Timer_Apbctrl1_getConfigRegisters(&second, &applied);
+    CHECK_TRUE(applied.isAutoReloaded);
+    CHECK_EQUAL(settings[1].reloadValue, applied.reloadValue);
+    CHECK_EQUAL(25000000u, settings[1].achievedPeriodNs);
+}
@@ -26,6 +26,8 @@ TEST_GROUP(TimerTests)
         testHandler.callback = (Timer_InterruptCallback)testCallback;
         testHandler.arg = &testArg;
         testArg = false;
+        testApbctrl1Timer.base = NULL;
+        testApbctrl2Timer.base = NULL;
     }
 };
 
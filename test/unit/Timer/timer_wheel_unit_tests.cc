@@ -0,0 +1,154 @@
+#include "CppUTest/TestHarness.h"
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+#include "TimerWheel.h"
+}
+
+#define TEST_TIMER_COUNT 1000u
+
+typedef struct
+{
+    Timer_Wheel* wheel;
+    Timer_WheelTimer* timer;
+    uint32_t firedAt;
+    uint32_t firedCount;
+    uint32_t period;
+} TestExpiry;
+
+static void
+recordExpiry(volatile void* arg)
+{
+    TestExpiry* const expiry = (TestExpiry*)arg;
+    expiry->firedAt = Timer_Wheel_getTime(expiry->wheel);
+    expiry->firedCount++;
+    if (expiry->period > 0) {
+        Timer_Wheel_schedule(expiry->wheel, expiry->timer, expiry->period);
+    }
+}
+
+TEST_GROUP(TimerWheelTests)
+{
+    Timer_Wheel wheel;
+    Timer_WheelTimer timers[TEST_TIMER_COUNT];
+    TestExpiry expiries[TEST_TIMER_COUNT];
+
+    void setup() {
+        Timer_Wheel_init(&wheel);
+        memset(expiries, 0, sizeof(expiries));
+        for (uint32_t i = 0; i < TEST_TIMER_COUNT; i++) {
+            expiries[i].wheel = &wheel;
+            expiries[i].timer = &timers[i];
+            const Timer_InterruptHandler handler = { .callback = recordExpiry, .arg = &expiries[i] };
+            Timer_Wheel_initTimer(&timers[i], handler);
+        }
+    }
+
+    void advance(const uint32_t ticks) {
+        for (uint32_t i = 0; i < ticks; i++) {
+            Timer_Wheel_tick(&wheel);
+        }
+    }
+};
+
+TEST(TimerWheelTests, Timer_Wheel_schedule_shouldExpireTimersOnEachLevelExactlyAtTimeout)
+{
+    const uint32_t timeouts[] = { 1u, 63u, 64u, 100u, 4095u, 4096u, 5000u, 300000u, 0x01000010u };
+    const uint32_t count = sizeof(timeouts) / sizeof(timeouts[0]);
+
+    advance(37u);
+    for (uint32_t i = 0; i < count; i++) {
+        Timer_Wheel_schedule(&wheel, &timers[i], timeouts[i]);
+        CHECK_TRUE(Timer_Wheel_isPending(&timers[i]));
+    }
+    advance(0x01000010u);
+
+    for (uint32_t i = 0; i < count; i++) {
+        CHECK_FALSE(Timer_Wheel_isPending(&timers[i]));
+        CHECK_EQUAL(1u, expiries[i].firedCount);
+        CHECK_EQUAL(37u + timeouts[i], expiries[i].firedAt);
+    }
+}
+
+TEST(TimerWheelTests, Timer_Wheel_schedule_shouldTreatZeroTimeoutAsNextTick)
+{
+    Timer_Wheel_schedule(&wheel, &timers[0], 0);
+
+    CHECK_EQUAL(1u, Timer_Wheel_tick(&wheel));
+    CHECK_EQUAL(1u, expiries[0].firedAt);
+}
+
+TEST(TimerWheelTests, Timer_Wheel_schedule_shouldMovePendingTimerToNewExpiry)
+{
+    Timer_Wheel_schedule(&wheel, &timers[0], 10u);
+    advance(5u);
+    Timer_Wheel_schedule(&wheel, &timers[0], 200u);
+    advance(300u);
+
+    CHECK_EQUAL(1u, expiries[0].firedCount);
+    CHECK_EQUAL(205u, expiries[0].firedAt);
+}
+
+TEST(TimerWheelTests, Timer_Wheel_cancel_shouldPreventDispatchAndReportPendingState)
+{
+    Timer_Wheel_schedule(&wheel, &timers[0], 10u);
+    Timer_Wheel_schedule(&wheel, &timers[1], 1000u);
+
+    CHECK_TRUE(Timer_Wheel_cancel(&wheel, &timers[0]));
+    CHECK_FALSE(Timer_Wheel_cancel(&wheel, &timers[0]));
+    advance(100u);
+    CHECK_TRUE(Timer_Wheel_cancel(&wheel, &timers[1]));
+    advance(1000u);
+
+    CHECK_FALSE(Timer_Wheel_isPending(&timers[0]));
+    CHECK_FALSE(Timer_Wheel_isPending(&timers[1]));
+    CHECK_EQUAL(0u, expiries[0].firedCount);
+    CHECK_EQUAL(0u, expiries[1].firedCount);
+}
+
+TEST(TimerWheelTests, Timer_Wheel_tick_shouldDispatchAllTimersDueInTickAsOneBatch)
+{
+    for (uint32_t i = 0; i < TEST_TIMER_COUNT; i++) {
+        Timer_Wheel_schedule(&wheel, &timers[i], 1u + (i % 2u) * 99u);
+    }
+
+    CHECK_EQUAL(TEST_TIMER_COUNT / 2u, Timer_Wheel_tick(&wheel));
+    advance(98u);
+    CHECK_EQUAL(TEST_TIMER_COUNT / 2u, Timer_Wheel_tick(&wheel));
+    for (uint32_t i = 0; i < TEST_TIMER_COUNT; i++) {
+        CHECK_EQUAL(1u, expiries[i].firedCount);
+        CHECK_EQUAL(1u + (i % 2u) * 99u, expiries[i].firedAt);
+    }
+}
+
+TEST(TimerWheelTests, Timer_Wheel_tick_shouldAllowCallbackToRescheduleItsTimer)
+{
+    expiries[0].period = 7u;
+    Timer_Wheel_schedule(&wheel, &timers[0], 7u);
+    advance(700u);
+
+    CHECK_EQUAL(100u, expiries[0].firedCount);
+    CHECK_EQUAL(700u, expiries[0].firedAt);
+    CHECK_TRUE(Timer_Wheel_isPending(&timers[0]));
+}
+
+TEST(TimerWheelTests, Timer_Wheel_startApbctrl1_shouldStartPeriodicTimerAdvancingTheWheel)
+{
+    Timer_Apbctrl1 timer;
+    Timer_Config config;
+    timer.base = NULL;
+
+    Timer_Wheel_startApbctrl1(&wheel, Timer_Id_1, &timer, 1000u);
+    Timer_Apbctrl1_getConfigRegisters(&timer, &config);
+
+    CHECK_TRUE(config.isEnabled);
+    CHECK_TRUE(config.isAutoReloaded);
+    CHECK_TRUE(config.isInterruptEnabled);
+    CHECK_FALSE(config.isChained);
+    CHECK_EQUAL(999u, config.reloadValue);
+
+    timer.irqHandler.callback(timer.irqHandler.arg);
+    CHECK_EQUAL(1u, Timer_Wheel_getTime(&wheel));
+}
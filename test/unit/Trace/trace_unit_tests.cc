@@ -0,0 +1,159 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <string.h>
+#include <stdint.h>
+
+extern "C"
+{
+#include "Trace.h"
+#include "Timer_private.h"
+#include "Uart.h"
+}
+
+#include "../Uart/uart_test_fifo.h"
+
+#ifdef TRACE_ENABLED
+static void
+testTimerCallback(volatile void* arg)
+{
+    *(volatile bool*)arg = true;
+}
+#endif
+
+static void
+collectLines(void* arg, const char* line)
+{
+    strcat((char*)arg, line);
+}
+
+TEST_GROUP(TraceTests)
+{
+    volatile uint32_t counter;
+    Trace_Entry entries[TRACE_RING_SIZE];
+
+    void setup() {
+      counter = 1000u;
+      memset(entries, 0, sizeof(entries));
+      Trace_init(&counter);
+    }
+
+    void teardown() {
+      Trace_setEnabled(false);
+    }
+};
+
+TEST(TraceTests, Trace_record_ShouldStoreEntriesWithElapsedTicks)
+{
+    counter = 990u;
+    Trace_record(Trace_Event_User, 1, 2, 0xABCDu);
+    counter = 900u;
+    Trace_record(Trace_Event_UartInterruptExit, 3, 4, 5);
+
+    CHECK_EQUAL(2, Trace_snapshot(entries, TRACE_RING_SIZE));
+    CHECK_EQUAL(10, entries[0].timestamp);
+    CHECK_EQUAL(Trace_Event_User, entries[0].event);
+    CHECK_EQUAL(1, entries[0].source);
+    CHECK_EQUAL(2, entries[0].count);
+    CHECK_EQUAL(0xABCDu, entries[0].value);
+    CHECK_EQUAL(100, entries[1].timestamp);
+    CHECK_EQUAL(Trace_Event_UartInterruptExit, entries[1].event);
+}
+
+TEST(TraceTests, Trace_record_ShouldOverwriteOldestEntriesWhenFull)
+{
+    for (uint32_t i = 0; i < TRACE_RING_SIZE + 3u; i++) {
+        Trace_record(Trace_Event_User, 0, 0, i);
+    }
+
+    CHECK_EQUAL(TRACE_RING_SIZE + 3u, Trace_getRecordedCount());
+    CHECK_EQUAL(TRACE_RING_SIZE, Trace_snapshot(entries, TRACE_RING_SIZE));
+    CHECK_EQUAL(3, entries[0].value);
+    CHECK_EQUAL(TRACE_RING_SIZE + 2u, entries[TRACE_RING_SIZE - 1u].value);
+
+    CHECK_EQUAL(2, Trace_snapshot(entries, 2));
+    CHECK_EQUAL(TRACE_RING_SIZE + 1u, entries[0].value);
+    CHECK_EQUAL(TRACE_RING_SIZE + 2u, entries[1].value);
+}
+
+TEST(TraceTests, Trace_setEnabled_ShouldFreezeTheRing)
+{
+    Trace_record(Trace_Event_User, 0, 0, 1);
+    Trace_setEnabled(false);
+    Trace_record(Trace_Event_User, 0, 0, 2);
+
+    CHECK_EQUAL(1, Trace_snapshot(entries, TRACE_RING_SIZE));
+    CHECK_EQUAL(1, entries[0].value);
+}
+
+TEST(TraceTests, Trace_dump_ShouldFormatEntriesOldestFirst)
+{
+    char text[128] = { 0 };
+    counter = 999u;
+    Trace_record(Trace_Event_UartInterruptEntry, 2, 0, 0x86u);
+    counter = 997u;
+    Trace_record(Trace_Event_UartInterruptExit, 2, 5, 0x6u);
+
+    Trace_dump(collectLines, text);
+    STRCMP_EQUAL("1,0,2,0,0x00000086\n3,1,2,5,0x00000006\n", text);
+}
+
+#ifdef TRACE_ENABLED
+TEST(TraceTests, Uart_handleInterrupt_ShouldRecordEntryAndExitWithTransferredBytes)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a' });
+    Uart uart;
+    Uart_Config config;
+    volatile bool isCallbackCalled = false;
+    Uart_TxHandler handler = { .callback = testTimerCallback, .arg = &isCallbackCalled };
+    Uart_init(Uart_Id_1, &uart);
+    memset(&config, 0, sizeof(config));
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    uart.reg->status = (1u << UART_STATUS_TS);
+
+    Uart_handleInterrupt(&uart);
+
+    CHECK_EQUAL(2, Trace_snapshot(entries, TRACE_RING_SIZE));
+    CHECK_EQUAL(Trace_Event_UartInterruptEntry, entries[0].event);
+    CHECK_EQUAL(Uart_Id_1, entries[0].source);
+    CHECK_EQUAL(1u << UART_STATUS_TS, entries[0].value);
+    CHECK_EQUAL(Trace_Event_UartInterruptExit, entries[1].event);
+    CHECK_EQUAL(1, entries[1].count);
+    Uart_shutdown(&uart);
+}
+
+TEST(TraceTests, Timer_handleIrq_ShouldRecordEntryAndExit)
+{
+    volatile bool isCallbackCalled = false;
+    Timer_InterruptHandler handler = { .callback = testTimerCallback, .arg = &isCallbackCalled };
+
+    Timer_handleIrq(&handler);
+
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_EQUAL(2, Trace_snapshot(entries, TRACE_RING_SIZE));
+    CHECK_EQUAL(Trace_Event_TimerInterruptEntry, entries[0].event);
+    CHECK_EQUAL(Trace_Event_TimerInterruptExit, entries[1].event);
+    CHECK_EQUAL((uint32_t)(uintptr_t)&handler, entries[1].value);
+}
+#endif
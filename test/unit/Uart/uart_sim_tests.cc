@@ -0,0 +1,392 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../sim/apbuart_sim.h"
+#include "uart_test_fifo.h"
+
+#define SIM_CLOCK_FREQUENCY 80000000u
+#define SIM_BENCHMARK_LENGTH 4096u
+
+static void
+countingCallback(volatile void* arg)
+{
+    (*(volatile uint32_t*)arg)++;
+}
+
+static void
+releasingRxBufferCallback(volatile void* arg, uint8_t* buffer, uint32_t length)
+{
+    (void)buffer;
+    (void)length;
+    Uart_releaseRxBuffer((Uart*)arg);
+}
+
+static void
+fillPattern(uint8_t* const data, const uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        data[i] = (uint8_t)(i * 7u + 1u);
+    }
+}
+
+TEST_GROUP(ApbuartSimTests)
+{
+    Uart uart;
+    Uart_Config config;
+    ApbuartSim sim;
+    volatile uint32_t callbackCount;
+
+    void setup() {
+      Uart_init(Uart_Id_0, &uart);
+      ApbuartSim_init(&sim, &uart, APBUART_SIM_GR712RC_FIFO_SIZE, SIM_CLOCK_FREQUENCY);
+      memset(&config, 0, sizeof(config));
+      config.baudRate = Uart_BaudRate_115200;
+      config.baudRateClkFreq = SIM_CLOCK_FREQUENCY;
+      callbackCount = 0;
+    }
+
+    void teardown() {
+      ApbuartSim_deinit(&sim);
+    }
+};
+
+TEST(ApbuartSimTests, Transmission_ShouldTakeOneInterruptPerByte)
+{
+    uint8_t data[16];
+    uint8_t line[16] = { 0 };
+    fillPattern(data, sizeof(data));
+    UART_FIFO_CREATE(txByteFifo, 16);
+    UartTestFifo_pushBlock(&txByteFifo, data, sizeof(data));
+    Uart_TxHandler handler = { .callback = countingCallback, .arg = &callbackCount };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    ApbuartSim_captureTx(&sim, line, sizeof(line));
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 32u * ApbuartSim_getFrameCycles(&sim)));
+
+    MEMCMP_EQUAL(data, line, sizeof(data));
+    CHECK_EQUAL(sizeof(data), sim.statistics.txFrameCount);
+    CHECK_EQUAL(sizeof(data), sim.statistics.interruptCount);
+    CHECK_EQUAL(1, callbackCount);
+}
+
+TEST(ApbuartSimTests, BulkTransmission_ShouldKeepLineBusyWithFewerInterrupts)
+{
+    uint8_t data[64];
+    uint8_t line[64] = { 0 };
+    fillPattern(data, sizeof(data));
+    UART_FIFO_CREATE(txByteFifo, 64);
+    UartTestFifo_pushBlock(&txByteFifo, data, sizeof(data));
+    Uart_TxHandler handler = { .callback = countingCallback, .arg = &callbackCount };
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    ApbuartSim_captureTx(&sim, line, sizeof(line));
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 128u * ApbuartSim_getFrameCycles(&sim)));
+
+    MEMCMP_EQUAL(data, line, sizeof(data));
+    CHECK_EQUAL(sizeof(data) * ApbuartSim_getFrameCycles(&sim), sim.cycle);
+    CHECK_TRUE(sim.statistics.interruptCount <= sizeof(data) / (APBUART_SIM_GR712RC_FIFO_SIZE / 2u));
+    CHECK_EQUAL(0, sim.statistics.txOverflowCount);
+    CHECK_EQUAL(1, callbackCount);
+}
+
+TEST(ApbuartSimTests, QueuedBulkTransmission_ShouldChainBuffersWithoutIdleLine)
+{
+    uint8_t data[64];
+    uint8_t line[64] = { 0 };
+    Uart_TxDescriptor queue[4];
+    fillPattern(data, sizeof(data));
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    ApbuartSim_captureTx(&sim, line, sizeof(line));
+
+    Uart_writeQueueAsync(&uart, queue, 4);
+    for (uint32_t i = 0; i < 4; i++) {
+        const Uart_TxDescriptor descriptor = { .data = &data[i * 16u],
+                                               .length = 16,
+                                               .handler = { .callback = countingCallback, .arg = &callbackCount } };
+        CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptor));
+    }
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 128u * ApbuartSim_getFrameCycles(&sim)));
+
+    MEMCMP_EQUAL(data, line, sizeof(data));
+    CHECK_EQUAL(sizeof(data) * ApbuartSim_getFrameCycles(&sim), sim.cycle);
+    CHECK_EQUAL(0, sim.statistics.txOverflowCount);
+    CHECK_EQUAL(4, callbackCount);
+}
+
+TEST(ApbuartSimTests, Reception_ShouldTakeOneInterruptPerByte)
+{
+    uint8_t data[16];
+    uint8_t received[16] = { 0 };
+    fillPattern(data, sizeof(data));
+    UART_FIFO_CREATE(rxByteFifo, 16);
+    Uart_RxHandler handler = { .lengthCallback = countingCallback,
+                               .characterCallback = countingCallback,
+                               .lengthArg = &callbackCount,
+                               .characterArg = &callbackCount,
+                               .targetCharacter = '\0',
+                               .targetLength = 16 };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_readAsync(&uart, &rxByteFifo, handler);
+    ApbuartSim_receive(&sim, data, sizeof(data));
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 32u * ApbuartSim_getFrameCycles(&sim)));
+
+    CHECK_EQUAL(sizeof(data), UartTestFifo_pullBlock(&rxByteFifo, received, sizeof(received)));
+    MEMCMP_EQUAL(data, received, sizeof(data));
+    CHECK_EQUAL(sizeof(data), sim.statistics.interruptCount);
+    CHECK_EQUAL(1, callbackCount);
+}
+
+TEST(ApbuartSimTests, BulkReception_ShouldDrainHardwareFifoOnLevelAndIdleInterrupts)
+{
+    uint8_t data[64];
+    uint8_t memoryBlock[64] = { 0 };
+    fillPattern(data, sizeof(data));
+    Uart_RxBufferHandler handler = { .callback = releasingRxBufferCallback, .arg = &uart };
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_readBuffersAsync(&uart, memoryBlock, 16, 4, handler);
+    ApbuartSim_receive(&sim, data, sizeof(data));
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 128u * ApbuartSim_getFrameCycles(&sim)));
+
+    MEMCMP_EQUAL(data, memoryBlock, sizeof(data));
+    CHECK_EQUAL(4, uart.rxBuffers.filledCount);
+    CHECK_EQUAL(0, sim.statistics.rxOverrunCount);
+    CHECK_TRUE(sim.statistics.interruptCount <= sizeof(data) / (APBUART_SIM_GR712RC_FIFO_SIZE / 2u) + 1u);
+}
+
+TEST(ApbuartSimTests, BulkReception_ShouldHandOverMoreBuffersThanOneCallbackBatch)
+{
+    uint8_t data[64];
+    uint8_t memoryBlock[64] = { 0 };
+    fillPattern(data, sizeof(data));
+    Uart_RxBufferHandler handler = { .callback = releasingRxBufferCallback, .arg = &uart };
+    ApbuartSim_deinit(&sim);
+    ApbuartSim_init(&sim, &uart, APBUART_SIM_MAX_FIFO_SIZE, SIM_CLOCK_FREQUENCY);
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    // Each level interrupt hands over more single-byte buffers than fit in
+    // one batch of callbacks
+    Uart_readBuffersAsync(&uart, memoryBlock, 1, sizeof(memoryBlock), handler);
+    ApbuartSim_receive(&sim, data, sizeof(data));
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 128u * ApbuartSim_getFrameCycles(&sim)));
+
+    MEMCMP_EQUAL(data, memoryBlock, sizeof(data));
+    CHECK_EQUAL(sizeof(data), uart.rxBuffers.filledCount);
+    CHECK_EQUAL(sizeof(data), uart.rxBuffers.releasedCount);
+    CHECK_EQUAL(0, sim.statistics.rxOverrunCount);
+}
+
+TEST(ApbuartSimTests, Reception_ShouldReportOverrunWhenHardwareFifoIsNotDrained)
+{
+    uint8_t data[16];
+    fillPattern(data, sizeof(data));
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_setFlag(&uart.reg->control, UART_FLAG_RESET, UART_CONTROL_RI);
+
+    ApbuartSim_receive(&sim, data, sizeof(data));
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 32u * ApbuartSim_getFrameCycles(&sim)));
+
+    CHECK_EQUAL(sizeof(data) - APBUART_SIM_GR712RC_FIFO_SIZE, sim.statistics.rxOverrunCount);
+    CHECK_TRUE(Uart_handleError(&uart));
+    CHECK_TRUE(uart.errorFlags.hasOverrunOccurred);
+}
+
+TEST(ApbuartSimTests, LoopbackMode_ShouldReceiveTransmittedBytes)
+{
+    uint8_t data[8];
+    uint8_t received[8] = { 0 };
+    fillPattern(data, sizeof(data));
+    UART_FIFO_CREATE(txByteFifo, 8);
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    UartTestFifo_pushBlock(&txByteFifo, data, sizeof(data));
+    Uart_TxHandler txHandler = { .callback = countingCallback, .arg = &callbackCount };
+    Uart_RxHandler rxHandler = { .lengthCallback = countingCallback,
+                                 .characterCallback = countingCallback,
+                                 .lengthArg = &callbackCount,
+                                 .characterArg = &callbackCount,
+                                 .targetCharacter = '\0',
+                                 .targetLength = 0 };
+    config.isTxEnabled = true;
+    config.isRxEnabled = true;
+    config.isLoopbackModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_readAsync(&uart, &rxByteFifo, rxHandler);
+    Uart_writeAsync(&uart, &txByteFifo, txHandler);
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 16u * ApbuartSim_getFrameCycles(&sim)));
+
+    CHECK_EQUAL(sizeof(data), UartTestFifo_pullBlock(&rxByteFifo, received, sizeof(received)));
+    MEMCMP_EQUAL(data, received, sizeof(data));
+}
+
+static uint8_t lastFrame[16];
+static uint32_t lastFrameLength;
+
+static void
+copyingRxFrameCallback(volatile void* arg, uint8_t* buffer, uint32_t length)
+{
+    memcpy(lastFrame, buffer, length);
+    lastFrameLength = length;
+    Uart_releaseRxBuffer((Uart*)arg);
+}
+
+TEST(ApbuartSimTests, FramedLoopbackMode_ShouldStuffAndReassembleFrames)
+{
+    const uint8_t payload[] = { 0x01, SLIP_END, 0x02, SLIP_ESC, 0x03 };
+    const uint8_t expectedLine[] = { SLIP_END, 0x01, SLIP_ESC, SLIP_ESC_END, 0x02, SLIP_ESC, SLIP_ESC_ESC, 0x03, SLIP_END };
+    const Uart_Buffer frames[] = { { .data = payload, .length = sizeof(payload) } };
+    uint8_t line[16] = { 0 };
+    uint8_t memoryBlock[2 * 8];
+    Uart_TxHandler txHandler = { .callback = countingCallback, .arg = &callbackCount };
+    Uart_RxBufferHandler rxHandler = { .callback = copyingRxFrameCallback, .arg = &uart };
+    lastFrameLength = 0;
+    config.isTxEnabled = true;
+    config.isRxEnabled = true;
+    config.isLoopbackModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    ApbuartSim_captureTx(&sim, line, sizeof(line));
+
+    Uart_readFramesAsync(&uart, memoryBlock, 8, 2, rxHandler);
+    Uart_writeFramesAsync(&uart, frames, 1, txHandler);
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 32u * ApbuartSim_getFrameCycles(&sim)));
+
+    CHECK_EQUAL(1, callbackCount);
+    CHECK_EQUAL(sizeof(expectedLine), sim.txLineLength);
+    MEMCMP_EQUAL(expectedLine, line, sizeof(expectedLine));
+    CHECK_EQUAL(sizeof(payload), lastFrameLength);
+    MEMCMP_EQUAL(payload, lastFrame, sizeof(payload));
+}
+
+TEST_GROUP(ApbuartSimBenchmarks)
+{
+    Uart uart;
+    Uart_Config config;
+    ApbuartSim sim;
+    volatile uint32_t callbackCount;
+    uint8_t data[SIM_BENCHMARK_LENGTH];
+    uint8_t memoryBlock[SIM_BENCHMARK_LENGTH];
+
+    void setup() {
+      Uart_init(Uart_Id_0, &uart);
+      ApbuartSim_init(&sim, &uart, APBUART_SIM_GR712RC_FIFO_SIZE, SIM_CLOCK_FREQUENCY);
+      memset(&config, 0, sizeof(config));
+      config.baudRate = Uart_BaudRate_115200;
+      config.baudRateClkFreq = SIM_CLOCK_FREQUENCY;
+      callbackCount = 0;
+      fillPattern(data, sizeof(data));
+    }
+
+    void teardown() {
+      ApbuartSim_deinit(&sim);
+    }
+
+    void report(const char* const name, const uint32_t bytes) {
+      const uint64_t lineCycles = (uint64_t)bytes * ApbuartSim_getFrameCycles(&sim);
+      const uint32_t interrupts = sim.statistics.interruptCount;
+      // One line per benchmark, key=value pairs for tracking across releases
+      printf("\nbenchmark=%s baud=%u bytes=%u interrupts=%u bytes_per_interrupt_x100=%u "
+             "line_utilization_pct=%u host_ns_per_interrupt=%u\n",
+             name,
+             (unsigned)config.baudRate,
+             (unsigned)bytes,
+             (unsigned)interrupts,
+             (unsigned)(interrupts > 0 ? (uint64_t)bytes * 100u / interrupts : 0),
+             (unsigned)(sim.cycle > 0 ? lineCycles * 100u / sim.cycle : 0),
+             (unsigned)(interrupts > 0 ? sim.statistics.handlerNanoseconds / interrupts : 0));
+    }
+};
+
+TEST(ApbuartSimBenchmarks, Transmission)
+{
+    UART_FIFO_CREATE(txByteFifo, SIM_BENCHMARK_LENGTH);
+    UartTestFifo_pushBlock(&txByteFifo, data, sizeof(data));
+    Uart_TxHandler handler = { .callback = countingCallback, .arg = &callbackCount };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 2u * sizeof(data) * ApbuartSim_getFrameCycles(&sim)));
+    report("tx", sizeof(data));
+}
+
+TEST(ApbuartSimBenchmarks, BulkTransmission)
+{
+    UART_FIFO_CREATE(txByteFifo, SIM_BENCHMARK_LENGTH);
+    UartTestFifo_pushBlock(&txByteFifo, data, sizeof(data));
+    Uart_TxHandler handler = { .callback = countingCallback, .arg = &callbackCount };
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 2u * sizeof(data) * ApbuartSim_getFrameCycles(&sim)));
+    report("tx_bulk", sizeof(data));
+}
+
+TEST(ApbuartSimBenchmarks, Reception)
+{
+    UART_FIFO_CREATE(rxByteFifo, SIM_BENCHMARK_LENGTH);
+    Uart_RxHandler handler = { .lengthCallback = countingCallback,
+                               .characterCallback = countingCallback,
+                               .lengthArg = &callbackCount,
+                               .characterArg = &callbackCount,
+                               .targetCharacter = '\0',
+                               .targetLength = 0 };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_readAsync(&uart, &rxByteFifo, handler);
+    ApbuartSim_receive(&sim, data, sizeof(data));
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 2u * sizeof(data) * ApbuartSim_getFrameCycles(&sim)));
+    report("rx", sizeof(data));
+}
+
+TEST(ApbuartSimBenchmarks, BulkReception)
+{
+    Uart_RxBufferHandler handler = { .callback = releasingRxBufferCallback, .arg = &uart };
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_readBuffersAsync(&uart, memoryBlock, 256, sizeof(memoryBlock) / 256, handler);
+    ApbuartSim_receive(&sim, data, sizeof(data));
+    CHECK_TRUE(ApbuartSim_runUntilIdle(&sim, 2u * sizeof(data) * ApbuartSim_getFrameCycles(&sim)));
+    report("rx_bulk", sizeof(data));
+}
@@ -0,0 +1,78 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Byte queue helpers for the Uart tests, so that the same tests run
+///        against whichever queue type UartFifo.h selects. SpscFifo queues
+///        need a power of two capacity, filled ones are rounded up to it.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "UartFifo.h"
+
+#ifdef UART_USE_SPSC_FIFO
+
+static constexpr uint32_t
+UartTestFifo_roundCapacity(const uint32_t length)
+{
+    return length <= 1u ? 1u : 2u * UartTestFifo_roundCapacity((length + 1u) / 2u);
+}
+
+#define UART_FIFO_CREATE(NAME, CAPACITY) SPSC_FIFO_CREATE(NAME, CAPACITY)
+
+// clang-format off
+#define UART_FIFO_CREATE_FILLED(NAME, ...)                                          \
+  const uint8_t NAME ## Contents[] = __VA_ARGS__;                                   \
+  SPSC_FIFO_CREATE(NAME, UartTestFifo_roundCapacity(sizeof(NAME ## Contents)));     \
+  SpscFifo_pushBlock(&NAME, NAME ## Contents, sizeof(NAME ## Contents))
+// clang-format on
+
+static inline size_t
+UartTestFifo_pushBlock(Uart_Fifo* const fifo, const uint8_t* const data, const size_t length)
+{
+    return SpscFifo_pushBlock(fifo, data, length);
+}
+
+static inline size_t
+UartTestFifo_pullBlock(Uart_Fifo* const fifo, uint8_t* const data, const size_t length)
+{
+    return SpscFifo_pullBlock(fifo, data, length);
+}
+
+#else
+
+#define UART_FIFO_CREATE(NAME, CAPACITY) BYTE_FIFO_CREATE(NAME, CAPACITY)
+#define UART_FIFO_CREATE_FILLED(NAME, ...) BYTE_FIFO_CREATE_FILLED(NAME, __VA_ARGS__)
+
+static inline size_t
+UartTestFifo_pushBlock(Uart_Fifo* const fifo, const uint8_t* const data, const size_t length)
+{
+    return ByteFifo_pushBlock(fifo, data, length);
+}
+
+static inline size_t
+UartTestFifo_pullBlock(Uart_Fifo* const fifo, uint8_t* const data, const size_t length)
+{
+    return ByteFifo_pullBlock(fifo, data, length);
+}
+
+#endif // UART_USE_SPSC_FIFO
@@ -26,15 +26,149 @@
 extern "C"
 {
 #include "Uart.h"
+#include "UartIdleTimer.h"
+}
+
+#include "uart_test_fifo.h"
+
+static void
+testCallback(volatile void* arg)
+{
+    *(volatile bool*)arg = true;
+}
+
+static uint8_t* lastRxBuffer;
+static uint32_t lastRxBufferLength;
+
+static void
+testRxBufferCallback(volatile void* arg, uint8_t* buffer, uint32_t length)
+{
+    *(volatile bool*)arg = true;
+    lastRxBuffer = buffer;
+    lastRxBufferLength = length;
+}
+
+static uint32_t lastBurstLength;
+static uint32_t burstCount;
+
+static void
+testRxBurstCallback(volatile void* arg, uint32_t length)
+{
+    (void)arg;
+    lastBurstLength = length;
+    burstCount++;
+}
+
+static uint32_t idleTimerRestartCount;
+static uint32_t idleTimerStopCount;
+static uint32_t lastIdleTimeout;
+
+static void
+testIdleTimerRestart(volatile void* timer, const uint32_t timeout)
+{
+    (void)timer;
+    lastIdleTimeout = timeout;
+    idleTimerRestartCount++;
+}
+
+static void
+testIdleTimerStop(volatile void* timer)
+{
+    (void)timer;
+    idleTimerStopCount++;
+}
+
+static Uart* hookedUart;
+
+static const uint8_t chainedData[] = { 'n' };
+static const Uart_Buffer chainedBuffer = { chainedData, sizeof(chainedData) };
+
+static void
+startChainedWrite(volatile void* arg)
+{
+    const Uart_TxHandler handler = { .callback = testCallback, .arg = arg };
+    Uart_writeVectorAsync(hookedUart, &chainedBuffer, 1, handler);
+}
+
+static void
+readStatisticsInCallback(volatile void* arg)
+{
+    Uart_getStatistics(hookedUart, (Uart_Statistics*)arg);
+}
+
+static uint32_t callbackChecksums[4];
+static uint32_t callbackChecksumCount;
+
+static void
+recordRxChecksum(volatile void* arg, uint8_t* buffer, uint32_t length)
+{
+    (void)arg;
+    (void)buffer;
+    (void)length;
+    callbackChecksums[callbackChecksumCount++ % 4] = Uart_getLastRxChecksum(hookedUart);
+}
+
+static void
+recordTxChecksum(volatile void* arg)
+{
+    (void)arg;
+    callbackChecksums[callbackChecksumCount++ % 4] = Uart_getLastTxChecksum(hookedUart);
+}
+
+static const uint8_t* hookedLine;
+static uint32_t hookedLineOffset;
+
+static uint8_t
+readHookedLine(Uart* const uart)
+{
+    (void)uart;
+    return hookedLine[hookedLineOffset++];
+}
+
+static void
+transmitAllBytes(void)
+{
+    for (int i = 0; i < 16; i++) {
+        Uart_handleTx(hookedUart);
+    }
+}
+
+static void
+receiveAllBytes(void)
+{
+    for (int i = 0; i < 16; i++) {
+        Uart_handleRx(hookedUart);
+    }
+}
+
+static void
+receiveTwoBytes(void)
+{
+    Uart_handleRx(hookedUart);
+    Uart_handleRx(hookedUart);
 }
 
 TEST_GROUP(UartTests)
 {
     Uart uart;
     Uart_Config config;
+    volatile bool isCallbackCalled;
 
     void setup() {
       Uart_init(Uart_Id_0, &uart);
+      memset(&config, 0, sizeof(config));
+      isCallbackCalled = false;
+      hookedUart = &uart;
+      lastBurstLength = 0;
+      burstCount = 0;
+      idleTimerRestartCount = 0;
+      idleTimerStopCount = 0;
+      lastIdleTimeout = 0;
+    }
+
+    void teardown() {
+      rtems_mock_event_receive_hook = NULL;
+      Uart_mockRegisterHooks.readData = NULL;
     }
 };
 
@@ -76,9 +210,10 @@ TEST(UartTests, Uart_setConfig_ShouldWriteProperUartConfigurationToTheControlReg
     CHECK_EQUAL(expectedValue, uart.reg->control);
 }
 
-TEST(UartTests, Uart_getConfig_ShouldReadProperUartConfigurationFromTheControlRegister)
+TEST(UartTests, Uart_getConfig_ShouldReadProperUartConfigurationFromTheControlShadow)
 {
-    uart.reg->control = 0x8A; // TE, TI, LB
+    uart.control = 0x8A; // TE, TI, LB
+    uart.reg->control = 0;
 
     Uart_getConfig(&uart, &config);
     CHECK_FALSE(config.isRxEnabled);
@@ -87,6 +222,180 @@ TEST(UartTests, Uart_getConfig_ShouldReadProperUartConfigurationFromTheControlRe
     CHECK_TRUE(config.parity == Uart_Parity_None);
 }
 
+TEST(UartTests, Uart_computeBaudRateSetting_ShouldSelectClosestScaler)
+{
+    Uart_BaudRateSetting setting;
+
+    CHECK_TRUE(Uart_computeBaudRateSetting(80000000u, Uart_BaudRate_115200, &setting));
+    CHECK_EQUAL(86, setting.scaler);
+    CHECK_EQUAL(114943, setting.achievedBaudRate);
+    CHECK_EQUAL(-22, setting.errorBasisPoints);
+
+    CHECK_TRUE(Uart_computeBaudRateSetting(80000000u, Uart_BaudRate_921600, &setting));
+    CHECK_EQUAL(10, setting.scaler);
+    CHECK_EQUAL(909091, setting.achievedBaudRate);
+    CHECK_EQUAL(-136, setting.errorBasisPoints);
+
+    CHECK_TRUE(Uart_computeBaudRateSetting(73728000u, Uart_BaudRate_460800, &setting));
+    CHECK_EQUAL(19, setting.scaler);
+    CHECK_EQUAL(460800, setting.achievedBaudRate);
+    CHECK_EQUAL(0, setting.errorBasisPoints);
+
+    CHECK_TRUE(Uart_computeBaudRateSetting(80000000u, 250000u, &setting));
+    CHECK_EQUAL(39, setting.scaler);
+    CHECK_EQUAL(0, setting.errorBasisPoints);
+}
+
+TEST(UartTests, Uart_computeBaudRateSetting_ShouldRejectRatesOutsideOfScalerRange)
+{
+    Uart_BaudRateSetting setting;
+
+    CHECK_FALSE(Uart_computeBaudRateSetting(80000000u, 0u, &setting));
+    CHECK_FALSE(Uart_computeBaudRateSetting(0u, Uart_BaudRate_115200, &setting));
+    CHECK_FALSE(Uart_computeBaudRateSetting(80000000u, Uart_BaudRate_1200, &setting));
+    CHECK_FALSE(Uart_computeBaudRateSetting(80000000u, 20000000u, &setting));
+    CHECK_TRUE(Uart_computeBaudRateSetting(80000000u, 2441u, &setting));
+    CHECK_EQUAL(4095, setting.scaler);
+}
+
+TEST(UartTests, Uart_setConfig_ShouldProgramScalerFromConfiguredClockFrequency)
+{
+    Uart_BaudRateSetting setting;
+    config.baudRate = Uart_BaudRate_230400;
+    config.baudRateClkFreq = 48000000u;
+
+    CHECK_FALSE(Uart_getBaudRateSetting(&uart, &setting));
+    CHECK_TRUE(Uart_setConfig(&uart, &config));
+    CHECK_EQUAL(25, uart.reg->clkscl);
+
+    CHECK_TRUE(Uart_getBaudRateSetting(&uart, &setting));
+    CHECK_EQUAL(25, setting.scaler);
+    CHECK_EQUAL(230769, setting.achievedBaudRate);
+    CHECK_EQUAL(16, setting.errorBasisPoints);
+
+    Uart_getConfig(&uart, &config);
+    CHECK_EQUAL(Uart_BaudRate_230400, config.baudRate);
+    CHECK_EQUAL(48000000u, config.baudRateClkFreq);
+}
+
+TEST(UartTests, Uart_setConfig_ShouldAcceptBaudRateWithoutNamedConstant)
+{
+    Uart_BaudRateSetting setting;
+    config.baudRate = 250000u;
+    config.baudRateClkFreq = 80000000u;
+
+    CHECK_TRUE(Uart_setConfig(&uart, &config));
+    CHECK_EQUAL(39, uart.reg->clkscl);
+    CHECK_TRUE(Uart_getBaudRateSetting(&uart, &setting));
+    CHECK_EQUAL(250000u, setting.achievedBaudRate);
+
+    Uart_getConfig(&uart, &config);
+    CHECK_EQUAL(250000u, config.baudRate);
+}
+
+TEST(UartTests, Uart_setConfig_ShouldKeepCurrentScalerWithoutClockFrequency)
+{
+    Uart_BaudRateSetting setting;
+    rtems_mock_ticks_per_second = 80000000u;
+    config.isTxEnabled = true;
+    config.baudRate = Uart_BaudRate_115200;
+    config.baudRateClkFreq = 0;
+    uart.reg->clkscl = 42;
+
+    CHECK_FALSE(Uart_setConfig(&uart, &config));
+    CHECK_EQUAL(42, uart.reg->clkscl);
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TE));
+    CHECK_FALSE(Uart_getBaudRateSetting(&uart, &setting));
+    rtems_mock_ticks_per_second = 0;
+}
+
+TEST(UartTests, Uart_applyConfig_ShouldSwitchBetweenPreparedConfigurations)
+{
+    Uart_PreparedConfig odd;
+    Uart_PreparedConfig plain;
+    config.isRxEnabled = true;
+    config.isTxEnabled = true;
+    config.parity = Uart_Parity_Odd;
+    config.baudRate = Uart_BaudRate_115200;
+    config.baudRateClkFreq = 80000000u;
+    CHECK_TRUE(Uart_prepareConfig(&config, &odd));
+    config.parity = Uart_Parity_None;
+    config.isRxBulkModeEnabled = true;
+    config.baudRate = Uart_BaudRate_921600;
+    CHECK_TRUE(Uart_prepareConfig(&config, &plain));
+
+    Uart_applyConfig(&uart, &odd);
+    CHECK_EQUAL(0x3F, uart.reg->control); // RE, TE, RI, TI, PS, PE
+    CHECK_EQUAL(86, uart.reg->clkscl);
+    CHECK_EQUAL(uart.reg->control, uart.control);
+
+    Uart_applyConfig(&uart, &plain);
+    CHECK_EQUAL(0x240F, uart.reg->control); // RE, TE, RI, TI, RF, DI
+    CHECK_EQUAL(10, uart.reg->clkscl);
+    CHECK_EQUAL(uart.reg->control, uart.control);
+    CHECK_TRUE(uart.isRxBulkModeEnabled);
+}
+
+TEST(UartTests, Uart_setConfig_ShouldKeepTxBulkTransferRunningWhenReconfigured)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a', 'b', 'c' });
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TF);
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+
+    config.parity = Uart_Parity_Odd;
+    Uart_setConfig(&uart, &config);
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_PE));
+    CHECK_EQUAL(uart.reg->control, uart.control);
+
+    uart.reg->status = 0;
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL('c', uart.reg->data);
+    CHECK_FALSE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_TRUE(isCallbackCalled);
+}
+
+TEST(UartTests, Uart_setConfig_ShouldContinueTxBulkTransferWithFrameInterruptsWhenBulkModeIsLeft)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a', 'b', 'c' });
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TF);
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+
+    uart.reg->status = (1u << UART_STATUS_TS);
+    config.isTxBulkModeEnabled = false;
+    Uart_setConfig(&uart, &config);
+    CHECK_EQUAL('a', uart.reg->data);
+    CHECK_FALSE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TI));
+
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL('c', uart.reg->data);
+    CHECK_TRUE(isCallbackCalled);
+}
+
+TEST(UartTests, Uart_prepareConfig_ShouldKeepCurrentScalerForUnreachableBaudRate)
+{
+    Uart_PreparedConfig prepared;
+    config.isTxEnabled = true;
+    config.baudRate = Uart_BaudRate_300;
+    config.baudRateClkFreq = 80000000u;
+    uart.reg->clkscl = 42;
+
+    CHECK_FALSE(Uart_prepareConfig(&config, &prepared));
+    Uart_applyConfig(&uart, &prepared);
+    CHECK_EQUAL(42, uart.reg->clkscl);
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TE));
+}
+
 TEST(UartTests, Uart_shutdown_ShouldClearStatusAndControlRegisterAndResetErrorFlags)
 {
     uart.reg->control = 0x8A; // TE, TI, LB
@@ -117,8 +426,8 @@ TEST(UartTests, Uart_handleError_ShouldReturnTrueWhileAnyOfErrorFlagsAreSet)
 
 TEST(UartTests, Uart_getRxFifoCount_ShouldReturnCorrectSizeOfTheBytesReadyToRead)
 {
-    BYTE_FIFO_CREATE(rxEmptyByteFifo, 1);
-    BYTE_FIFO_CREATE_FILLED(rxFilledByteFifo, "Test string");
+    UART_FIFO_CREATE(rxEmptyByteFifo, 1);
+    UART_FIFO_CREATE_FILLED(rxFilledByteFifo, "Test string");
     size_t stringLen = strlen("Test string") + 1; // BYTE_FIFO adds 1 byte to the string
     uart.rxFifo = &rxEmptyByteFifo;
 
@@ -129,8 +438,8 @@ TEST(UartTests, Uart_getRxFifoCount_ShouldReturnCorrectSizeOfTheBytesReadyToRead
 
 TEST(UartTests, Uart_getTxFifoCount_ShouldReturnCorrectSizeOfTheBytesReadyToSend)
 {
-    BYTE_FIFO_CREATE(txEmptyByteFifo, 1);
-    BYTE_FIFO_CREATE_FILLED(txFilledByteFifo, "Test string");
+    UART_FIFO_CREATE(txEmptyByteFifo, 1);
+    UART_FIFO_CREATE_FILLED(txFilledByteFifo, "Test string");
     size_t stringLen = strlen("Test string") + 1; // BYTE_FIFO adds 1 byte to the string
     uart.txFifo = &txEmptyByteFifo;
 
@@ -141,8 +450,8 @@ TEST(UartTests, Uart_getTxFifoCount_ShouldReturnCorrectSizeOfTheBytesReadyToSend
 
 TEST(UartTests, Uart_isRxEmpty_ShouldReturnIfReadFifoIsEmpty)
 {
-    BYTE_FIFO_CREATE(rxEmptyByteFifo, 1);
-    BYTE_FIFO_CREATE_FILLED(rxFilledByteFifo, "Test string");
+    UART_FIFO_CREATE(rxEmptyByteFifo, 1);
+    UART_FIFO_CREATE_FILLED(rxFilledByteFifo, "Test string");
     uart.rxFifo = &rxEmptyByteFifo;
 
     CHECK_TRUE(Uart_isRxEmpty(&uart));
@@ -152,11 +461,1102 @@ TEST(UartTests, Uart_isRxEmpty_ShouldReturnIfReadFifoIsEmpty)
 
 TEST(UartTests, Uart_isTxEmpty_ShouldReturnIfTransmitFifoIsEmpty)
 {
-    BYTE_FIFO_CREATE(txEmptyByteFifo, 1);
-    BYTE_FIFO_CREATE_FILLED(txFilledByteFifo, "Test string");
+    UART_FIFO_CREATE(txEmptyByteFifo, 1);
+    UART_FIFO_CREATE_FILLED(txFilledByteFifo, "Test string");
     uart.txFifo = &txEmptyByteFifo;
 
     CHECK_TRUE(Uart_isTxEmpty(&uart));
     uart.txFifo = &txFilledByteFifo;
     CHECK_FALSE(Uart_isTxEmpty(&uart));
 }
+
+TEST(UartTests, Uart_setConfig_ShouldUseFifoLevelInterruptsInTxBulkMode)
+{
+    uint32_t expectedValue = 0x0F; // RE, TE, RI, TI
+
+    config.isRxEnabled = true;
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    CHECK_EQUAL(expectedValue, uart.reg->control);
+
+    uart.reg->control = 0;
+    config.isTxBulkModeEnabled = true;
+    expectedValue = 0x07; // RE, TE, RI
+    Uart_setConfig(&uart, &config);
+    CHECK_EQUAL(expectedValue, uart.reg->control);
+    CHECK_TRUE(uart.isTxBulkModeEnabled);
+}
+
+TEST(UartTests, Uart_writeAsync_ShouldFillHardwareFifoAndEnableFifoInterruptInTxBulkMode)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a', 'b', 'c' });
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = 0;
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+
+    CHECK_TRUE(Uart_Fifo_isEmpty(&txByteFifo));
+    CHECK_EQUAL('c', uart.reg->data);
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_FALSE(isCallbackCalled);
+
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_FALSE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_FALSE(Uart_handleTx(&uart));
+}
+
+TEST(UartTests, Uart_handleTx_ShouldNotWriteToFullHardwareFifoInTxBulkMode)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a', 'b', 'c' });
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TF);
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    CHECK_TRUE(Uart_handleTx(&uart));
+
+    CHECK_EQUAL(3, Uart_Fifo_getCount(&txByteFifo));
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_FALSE(isCallbackCalled);
+}
+
+TEST(UartTests, Uart_setConfig_ShouldUseFifoLevelAndDelayedInterruptsInRxBulkMode)
+{
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_RE));
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_RF));
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_DI));
+    CHECK_TRUE(uart.isRxBulkModeEnabled);
+}
+
+TEST(UartTests, Uart_handleRx_ShouldDrainAllPendingFramesInRxBulkMode)
+{
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    Uart_RxHandler handler = { .lengthCallback = testCallback,
+                               .characterCallback = testCallback,
+                               .lengthArg = &isCallbackCalled,
+                               .characterArg = &isCallbackCalled,
+                               .targetCharacter = '\0',
+                               .targetLength = 5 };
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readAsync(&uart, &rxByteFifo, handler);
+    uart.reg->data = 'x';
+    uart.reg->status = (5u << UART_STATUS_RCNT_OFFSET) | (1u << UART_STATUS_DR);
+
+    CHECK_TRUE(Uart_handleRx(&uart));
+    CHECK_EQUAL(5, Uart_Fifo_getCount(&rxByteFifo));
+    CHECK_TRUE(isCallbackCalled);
+}
+
+TEST(UartTests, Uart_handleRx_ShouldDiscardPendingFramesWithoutReceptionSinkInRxBulkMode)
+{
+    Uart_Statistics statistics;
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->data = 'x';
+    uart.reg->status = (5u << UART_STATUS_RCNT_OFFSET) | (1u << UART_STATUS_DR);
+
+    CHECK_TRUE(Uart_handleRx(&uart));
+
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(5, statistics.rxBytes);
+    CHECK_EQUAL(5, statistics.rxDrops);
+}
+
+TEST(UartTests, Uart_flushRx_ShouldDrainRemainingFramesFromHardwareFifo)
+{
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.rxFifo = &rxByteFifo;
+    uart.reg->status = 0;
+
+    CHECK_EQUAL(0, Uart_flushRx(&uart));
+
+    uart.reg->status = (1u << UART_STATUS_DR);
+    CHECK_EQUAL(1, Uart_flushRx(&uart));
+    uart.reg->status = (2u << UART_STATUS_RCNT_OFFSET) | (1u << UART_STATUS_DR);
+    CHECK_EQUAL(2, Uart_flushRx(&uart));
+    CHECK_EQUAL(3, Uart_Fifo_getCount(&rxByteFifo));
+}
+
+TEST(UartTests, Uart_writeVectorAsync_ShouldSendAllBuffersAndCallCallbackOnce)
+{
+    const uint8_t header[] = { 'h', 'd' };
+    const uint8_t payload[] = { 'p' };
+    const uint8_t crc[] = { 'c', 'r' };
+    const Uart_Buffer buffers[] = { { header, sizeof(header) },
+                                    { NULL, 0 },
+                                    { payload, sizeof(payload) },
+                                    { crc, sizeof(crc) } };
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    const uint8_t expected[] = { 'h', 'd', 'p', 'c', 'r' };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TS);
+
+    Uart_writeVectorAsync(&uart, buffers, 4, handler);
+    CHECK_EQUAL(expected[0], uart.reg->data);
+    for (size_t i = 1; i < sizeof(expected); i++) {
+        CHECK_FALSE(isCallbackCalled);
+        CHECK_FALSE(Uart_isTxEmpty(&uart));
+        CHECK_TRUE(Uart_handleTx(&uart));
+        CHECK_EQUAL(expected[i], uart.reg->data);
+    }
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+
+    isCallbackCalled = false;
+    uart.reg->data = 0;
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL(0, uart.reg->data);
+    CHECK_FALSE(isCallbackCalled);
+}
+
+TEST(UartTests, Uart_writeVectorAsync_ShouldCallCallbackAtOnceWithoutBytesToSend)
+{
+    const Uart_Buffer buffers[] = { { NULL, 0 }, { NULL, 0 } };
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TS);
+    uart.reg->data = 0;
+
+    Uart_writeVectorAsync(&uart, buffers, 2, handler);
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+    CHECK_EQUAL(0, uart.reg->data);
+
+    isCallbackCalled = false;
+    Uart_writeVectorAsync(&uart, buffers, 0, handler);
+    CHECK_TRUE(isCallbackCalled);
+}
+
+TEST(UartTests, Uart_writeVectorAsync_ShouldFillHardwareFifoInTxBulkMode)
+{
+    const uint8_t header[] = { 'h', 'd' };
+    const uint8_t payload[] = { 'p', 'l' };
+    const Uart_Buffer buffers[] = { { header, sizeof(header) },
+                                    { payload, sizeof(payload) } };
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = 0;
+
+    Uart_writeVectorAsync(&uart, buffers, 2, handler);
+    CHECK_EQUAL('l', uart.reg->data);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+    CHECK_FALSE(isCallbackCalled);
+
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_FALSE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+}
+
+TEST(UartTests, Uart_readBuffersAsync_ShouldHandOverFullBuffersInTurn)
+{
+    uint8_t memoryBlock[2 * 3];
+    Uart_RxBufferHandler handler = { .callback = testRxBufferCallback, .arg = &isCallbackCalled };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_DR);
+
+    Uart_readBuffersAsync(&uart, memoryBlock, 3, 2, handler);
+    for (uint8_t i = 0; i < 6; i++) {
+        uart.reg->data = i;
+        CHECK_TRUE(Uart_handleRx(&uart));
+        if (i == 2) {
+            CHECK_TRUE(isCallbackCalled);
+            POINTERS_EQUAL(memoryBlock, lastRxBuffer);
+            CHECK_EQUAL(3, lastRxBufferLength);
+            isCallbackCalled = false;
+        }
+    }
+    CHECK_TRUE(isCallbackCalled);
+    POINTERS_EQUAL(memoryBlock + 3, lastRxBuffer);
+    CHECK_EQUAL(3, lastRxBufferLength);
+
+    const uint8_t expected[] = { 0, 1, 2, 3, 4, 5 };
+    CHECK_EQUAL(0, memcmp(expected, memoryBlock, sizeof(expected)));
+}
+
+TEST(UartTests, Uart_readBuffersAsync_ShouldDropBytesUntilBufferIsReleased)
+{
+    uint8_t memoryBlock[2 * 2] = { 0 };
+    Uart_RxBufferHandler handler = { .callback = testRxBufferCallback, .arg = &isCallbackCalled };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_DR);
+    uart.reg->data = 'a';
+
+    Uart_readBuffersAsync(&uart, memoryBlock, 2, 2, handler);
+    for (int i = 0; i < 4; i++) {
+        Uart_handleRx(&uart);
+    }
+    CHECK_FALSE(uart.errorFlags.hasRxFifoFullErrorOccurred);
+
+    uart.reg->data = 'b';
+    Uart_handleRx(&uart);
+    CHECK_TRUE(uart.errorFlags.hasRxFifoFullErrorOccurred);
+    CHECK_EQUAL('a', memoryBlock[0]);
+
+    CHECK_TRUE(Uart_releaseRxBuffer(&uart));
+    Uart_handleRx(&uart);
+    CHECK_EQUAL('b', memoryBlock[0]);
+    CHECK_TRUE(Uart_releaseRxBuffer(&uart));
+    CHECK_FALSE(Uart_releaseRxBuffer(&uart));
+}
+
+TEST(UartTests, Uart_flushRx_ShouldHandOverPartiallyFilledBuffer)
+{
+    uint8_t memoryBlock[2 * 4];
+    Uart_RxBufferHandler handler = { .callback = testRxBufferCallback, .arg = &isCallbackCalled };
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = 0;
+
+    Uart_readBuffersAsync(&uart, memoryBlock, 4, 2, handler);
+    CHECK_EQUAL(0, Uart_flushRx(&uart));
+    CHECK_FALSE(isCallbackCalled);
+
+    uart.reg->status = (2u << UART_STATUS_RCNT_OFFSET) | (1u << UART_STATUS_DR);
+    CHECK_EQUAL(2, Uart_flushRx(&uart));
+    CHECK_TRUE(isCallbackCalled);
+    POINTERS_EQUAL(memoryBlock, lastRxBuffer);
+    CHECK_EQUAL(2, lastRxBufferLength);
+}
+
+TEST(UartTests, Uart_writeBuffer_ShouldReturnAfterInterruptDrivenTransmission)
+{
+    const uint8_t data[] = { 'a', 'b', 'c' };
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TS);
+    rtems_mock_event_receive_hook = transmitAllBytes;
+
+    CHECK_TRUE(Uart_writeBuffer(&uart, data, sizeof(data), 10, &errCode));
+    CHECK_EQUAL('c', uart.reg->data);
+    CHECK_EQUAL(Uart_ErrorCode_OK, errCode);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+}
+
+TEST(UartTests, Uart_writeBuffer_ShouldAbortTransmissionOnTimeout)
+{
+    const uint8_t data[] = { 'a', 'b', 'c' };
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TS);
+
+    CHECK_FALSE(Uart_writeBuffer(&uart, data, sizeof(data), 10, &errCode));
+    CHECK_EQUAL(Uart_ErrorCode_Timeout, errCode);
+    CHECK_EQUAL('a', uart.reg->data);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+
+    uart.reg->data = 0;
+    Uart_handleTx(&uart);
+    CHECK_EQUAL(0, uart.reg->data);
+}
+
+TEST(UartTests, Uart_writeBuffer_ShouldFailWithoutTouchingTransmissionInProgress)
+{
+    const uint8_t pending[] = { 'p', 'q' };
+    const Uart_Buffer buffers[] = { { pending, sizeof(pending) } };
+    const uint8_t data[] = { 'a', 'b', 'c' };
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TS);
+    Uart_writeVectorAsync(&uart, buffers, 1, handler);
+
+    CHECK_FALSE(Uart_writeBuffer(&uart, data, sizeof(data), 10, &errCode));
+    CHECK_EQUAL(Uart_ErrorCode_TxBusy, errCode);
+    CHECK_EQUAL('p', uart.reg->data);
+
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL('q', uart.reg->data);
+    CHECK_TRUE(isCallbackCalled);
+}
+
+TEST(UartTests, Uart_writeBuffer_ShouldFailWhileDescriptorQueueIsAttached)
+{
+    Uart_TxDescriptor descriptors[2];
+    const uint8_t data[] = { 'a' };
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_writeQueueAsync(&uart, descriptors, 2);
+
+    CHECK_FALSE(Uart_writeBuffer(&uart, data, sizeof(data), 10, &errCode));
+    CHECK_EQUAL(Uart_ErrorCode_TxBusy, errCode);
+    POINTERS_EQUAL(descriptors, uart.txQueue.descriptors);
+    CHECK_EQUAL(2, uart.txQueue.capacity);
+}
+
+TEST(UartTests, Uart_readBuffer_ShouldReturnAfterInterruptDrivenReception)
+{
+    uint8_t data[4] = { 0 };
+    uint32_t receivedLength = 0;
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_DR);
+    uart.reg->data = 'x';
+    rtems_mock_event_receive_hook = receiveAllBytes;
+
+    CHECK_TRUE(Uart_readBuffer(&uart, data, sizeof(data), 10, &receivedLength, &errCode));
+    CHECK_EQUAL(Uart_ErrorCode_OK, errCode);
+    CHECK_EQUAL(sizeof(data), receivedLength);
+    CHECK_EQUAL('x', data[3]);
+    CHECK_TRUE(uart.rxBuffers.memoryBlock == NULL);
+    // Bytes following the completed read have no sink, the buffer did not
+    // overflow
+    CHECK_FALSE(uart.errorFlags.hasRxFifoFullErrorOccurred);
+}
+
+TEST(UartTests, Uart_readBuffer_ShouldReportReceivedLengthOnTimeout)
+{
+    uint8_t data[4] = { 0 };
+    uint32_t receivedLength = 0;
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_DR);
+    uart.reg->data = 'x';
+    rtems_mock_event_receive_hook = receiveTwoBytes;
+
+    CHECK_FALSE(Uart_readBuffer(&uart, data, sizeof(data), 10, &receivedLength, &errCode));
+    CHECK_EQUAL(Uart_ErrorCode_Timeout, errCode);
+    CHECK_EQUAL(2, receivedLength);
+    CHECK_EQUAL('x', data[1]);
+    CHECK_EQUAL(0, data[2]);
+    CHECK_TRUE(uart.rxBuffers.memoryBlock == NULL);
+}
+
+TEST(UartTests, Uart_readBuffer_ShouldFailWhileAsynchronousReceptionIsActive)
+{
+    UART_FIFO_CREATE(rxByteFifo, 4);
+    uint8_t data[4] = { 0 };
+    uint32_t receivedLength = 0;
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    uart.rxFifo = &rxByteFifo;
+
+    CHECK_FALSE(Uart_readBuffer(&uart, data, sizeof(data), 10, &receivedLength, &errCode));
+    CHECK_EQUAL(Uart_ErrorCode_RxFifoNotNull, errCode);
+}
+
+TEST(UartTests, Uart_setInterruptAffinity_ShouldRouteInterruptToSelectedProcessor)
+{
+    Uart_init(Uart_Id_2, &uart);
+
+    CHECK_TRUE(Uart_setInterruptAffinity(&uart, 1));
+    CHECK_EQUAL(Uart2_interrupt, rtems_mock_affinity_vector);
+    CHECK_EQUAL(1, rtems_mock_affinity_cpu);
+}
+
+TEST(UartTests, Uart_setInterruptAffinity_ShouldRejectMissingProcessor)
+{
+    rtems_mock_affinity_cpu = 0;
+
+    CHECK_FALSE(Uart_setInterruptAffinity(&uart, rtems_mock_processor_maximum));
+    CHECK_EQUAL(0, rtems_mock_affinity_cpu);
+}
+
+TEST(UartTests, Uart_handleInterrupt_ShouldHoldDescriptorLock)
+{
+    const uint32_t acquireCount = uart.lock.acquireCount;
+
+    Uart_handleInterrupt(&uart);
+    CHECK_EQUAL(acquireCount + 1u, uart.lock.acquireCount);
+    CHECK_EQUAL(0, uart.lock.depth);
+}
+
+TEST(UartTests, Uart_writeAsync_ShouldReleaseDescriptorLock)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a' });
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    CHECK_EQUAL(0, uart.lock.depth);
+    CHECK_TRUE(uart.lock.acquireCount > 0);
+}
+
+TEST(UartTests, Uart_read_ShouldReleaseDescriptorLockOnTimeout)
+{
+    uint8_t data = 0;
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    uart.reg->status = 0;
+
+    CHECK_FALSE(Uart_read(&uart, &data, 2, &errCode));
+    CHECK_EQUAL(Uart_ErrorCode_Timeout, errCode);
+    CHECK_EQUAL(0, uart.lock.depth);
+}
+
+TEST(UartTests, Uart_handleInterrupt_ShouldAllowStartingWriteFromTxCallback)
+{
+    const uint8_t first[] = { 'a', 'b' };
+    const Uart_Buffer buffer = { first, sizeof(first) };
+    Uart_TxHandler handler = { .callback = startChainedWrite, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TS);
+
+    Uart_writeVectorAsync(&uart, &buffer, 1, handler);
+    CHECK_EQUAL('a', uart.reg->data);
+    Uart_handleInterrupt(&uart);
+    CHECK_EQUAL('n', uart.reg->data);
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+    CHECK_EQUAL(0, uart.lock.depth);
+}
+
+TEST(UartTests, Uart_getStatistics_ShouldCountTransferredBytesAndInterrupts)
+{
+    UART_FIFO_CREATE(rxByteFifo, 4);
+    Uart_RxHandler handler = { .lengthCallback = testCallback,
+                               .characterCallback = testCallback,
+                               .lengthArg = &isCallbackCalled,
+                               .characterArg = &isCallbackCalled,
+                               .targetCharacter = '\n',
+                               .targetLength = 0 };
+    Uart_Statistics statistics;
+    Uart_ErrorCode errCode = Uart_ErrorCode_OK;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readAsync(&uart, &rxByteFifo, handler);
+    uart.reg->status = (1u << UART_STATUS_DR) | (1u << UART_STATUS_TS);
+    uart.reg->data = 'x';
+
+    Uart_handleInterrupt(&uart);
+    Uart_handleInterrupt(&uart);
+    CHECK_TRUE(Uart_write(&uart, 'y', 1, &errCode));
+
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(1, statistics.txBytes);
+    CHECK_EQUAL(2, statistics.rxBytes);
+    CHECK_EQUAL(2, statistics.interrupts);
+    CHECK_EQUAL(2, statistics.rxQueuePeak);
+    CHECK_EQUAL(0, statistics.rxDrops);
+    CHECK_EQUAL(0, uart.statistics.sequence & 1u);
+}
+
+TEST(UartTests, Uart_handleError_ShouldCountAndClearStickyErrors)
+{
+    Uart_Statistics statistics;
+    uart.reg->status = (1u << UART_STATUS_OV) | (1u << UART_STATUS_FE) | (1u << UART_STATUS_TS);
+
+    CHECK_TRUE(Uart_handleError(&uart));
+    CHECK_EQUAL(1u << UART_STATUS_TS, uart.reg->status);
+    CHECK_FALSE(Uart_handleError(&uart));
+
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(1, statistics.overruns);
+    CHECK_EQUAL(0, statistics.parityErrors);
+    CHECK_EQUAL(1, statistics.framingErrors);
+}
+
+TEST(UartTests, Uart_getStatistics_ShouldBeCallableFromHandlers)
+{
+    Uart_Statistics statistics = {};
+    Uart_ErrorHandler handler = { .callback = readStatisticsInCallback, .arg = &statistics };
+    Uart_registerErrorHandler(&uart, handler);
+    uart.reg->status = (1u << UART_STATUS_OV);
+
+    CHECK_TRUE(Uart_handleError(&uart));
+    CHECK_EQUAL(1, statistics.overruns);
+
+    uart.reg->status = (1u << UART_STATUS_FE);
+    Uart_handleInterrupt(&uart);
+    CHECK_EQUAL(1, statistics.framingErrors);
+    CHECK_EQUAL(1, statistics.interrupts);
+    CHECK_EQUAL(0, uart.statistics.sequence & 1u);
+}
+
+TEST(UartTests, Uart_resetStatistics_ShouldRestartCountersAndPeaks)
+{
+    UART_FIFO_CREATE(rxByteFifo, 1);
+    Uart_RxHandler handler = { .lengthCallback = testCallback,
+                               .characterCallback = testCallback,
+                               .lengthArg = &isCallbackCalled,
+                               .characterArg = &isCallbackCalled,
+                               .targetCharacter = '\n',
+                               .targetLength = 0 };
+    Uart_Statistics statistics;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readAsync(&uart, &rxByteFifo, handler);
+    uart.reg->status = (1u << UART_STATUS_DR);
+    uart.reg->data = 'x';
+    Uart_handleInterrupt(&uart);
+    Uart_handleInterrupt(&uart);
+
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(1, statistics.rxDrops);
+    CHECK_EQUAL(1, statistics.rxQueuePeak);
+
+    Uart_resetStatistics(&uart);
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(0, statistics.rxBytes);
+    CHECK_EQUAL(0, statistics.rxDrops);
+    CHECK_EQUAL(0, statistics.interrupts);
+    CHECK_EQUAL(0, statistics.rxQueuePeak);
+
+    uart.reg->status = 0;
+    Uart_handleInterrupt(&uart);
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(1, statistics.interrupts);
+    CHECK_EQUAL(0, statistics.rxQueuePeak);
+}
+
+TEST(UartTests, Uart_readCoalescedAsync_ShouldNotifyOnceThresholdIsReached)
+{
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    const Uart_RxBurstHandler handler = { .callback = testRxBurstCallback,
+                                          .arg = NULL,
+                                          .threshold = 3,
+                                          .idleTimeout = 100,
+                                          .idleTimer = { .restart = testIdleTimerRestart,
+                                                         .stop = testIdleTimerStop,
+                                                         .timer = NULL } };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readCoalescedAsync(&uart, &rxByteFifo, handler);
+    uart.reg->status = (1u << UART_STATUS_DR);
+    uart.reg->data = 'x';
+
+    Uart_handleRx(&uart);
+    Uart_handleRx(&uart);
+    CHECK_EQUAL(0, burstCount);
+    CHECK_EQUAL(2, idleTimerRestartCount);
+    CHECK_EQUAL(100, lastIdleTimeout);
+
+    Uart_handleRx(&uart);
+    CHECK_EQUAL(1, burstCount);
+    CHECK_EQUAL(3, lastBurstLength);
+    CHECK_EQUAL(1, idleTimerStopCount);
+    CHECK_EQUAL(2, idleTimerRestartCount);
+    CHECK_EQUAL(3, Uart_getRxFifoCount(&uart));
+}
+
+TEST(UartTests, Uart_handleRxIdleTimeout_ShouldNotifyAboutPendingBurst)
+{
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    const Uart_RxBurstHandler handler = { .callback = testRxBurstCallback,
+                                          .arg = NULL,
+                                          .threshold = 0,
+                                          .idleTimeout = 100,
+                                          .idleTimer = { .restart = testIdleTimerRestart,
+                                                         .stop = testIdleTimerStop,
+                                                         .timer = NULL } };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readCoalescedAsync(&uart, &rxByteFifo, handler);
+
+    Uart_handleRxIdleTimeout(&uart);
+    CHECK_EQUAL(0, burstCount);
+
+    uart.reg->status = (1u << UART_STATUS_DR);
+    uart.reg->data = 'x';
+    Uart_handleRx(&uart);
+    Uart_handleRx(&uart);
+    Uart_handleRxIdleTimeout(&uart);
+    CHECK_EQUAL(1, burstCount);
+    CHECK_EQUAL(2, lastBurstLength);
+
+    Uart_handleRxIdleTimeout(&uart);
+    CHECK_EQUAL(1, burstCount);
+}
+
+TEST(UartTests, Uart_readCoalescedAsync_ShouldRestartIdleTimerOncePerDrainedBatch)
+{
+    UART_FIFO_CREATE(rxByteFifo, 16);
+    const Uart_RxBurstHandler handler = { .callback = testRxBurstCallback,
+                                          .arg = NULL,
+                                          .threshold = 0,
+                                          .idleTimeout = 100,
+                                          .idleTimer = { .restart = testIdleTimerRestart,
+                                                         .stop = testIdleTimerStop,
+                                                         .timer = NULL } };
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readCoalescedAsync(&uart, &rxByteFifo, handler);
+    uart.reg->status = (1u << UART_STATUS_DR) | (5u << UART_STATUS_RCNT_OFFSET);
+
+    Uart_handleRx(&uart);
+    CHECK_EQUAL(1, idleTimerRestartCount);
+    CHECK_EQUAL(0, burstCount);
+    CHECK_EQUAL(5, Uart_getRxFifoCount(&uart));
+}
+
+TEST(UartTests, Uart_initApbctrl1IdleTimer_ShouldArmOneShotTimerEndingTheBurst)
+{
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    Timer_Apbctrl1 timer;
+    Uart_RxBurstHandler handler = { .callback = testRxBurstCallback,
+                                    .arg = NULL,
+                                    .threshold = 0,
+                                    .idleTimeout = 50,
+                                    .idleTimer = { .restart = NULL, .stop = NULL, .timer = NULL } };
+    Uart_IdleTimer* const idleTimer = &handler.idleTimer;
+    timer.base = NULL;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_initApbctrl1IdleTimer(&uart, Timer_Id_2, &timer, idleTimer);
+    Uart_readCoalescedAsync(&uart, &rxByteFifo, handler);
+    uart.reg->status = (1u << UART_STATUS_DR);
+    uart.reg->data = 'x';
+    Uart_handleRx(&uart);
+    CHECK_EQUAL(49, timer.regs->reload);
+    CHECK_EQUAL((1u << TIMER_CONTROL_EN) | (1u << TIMER_CONTROL_LD) | (1u << TIMER_CONTROL_IE),
+                timer.regs->control);
+
+    timer.irqHandler.callback(timer.irqHandler.arg);
+    CHECK_EQUAL(1, burstCount);
+    CHECK_EQUAL(1, lastBurstLength);
+    CHECK_EQUAL(0, timer.regs->control & (1u << TIMER_CONTROL_EN));
+}
+
+static void
+receiveLine(Uart* const uart, const uint8_t* const line, const uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++) {
+        uart->reg->data = line[i];
+        Uart_handleRx(uart);
+    }
+}
+
+TEST(UartTests, Uart_readFramesAsync_ShouldHandOverDecodedFrames)
+{
+    const uint8_t line[] = { SLIP_END, SLIP_END, 'a', SLIP_ESC, SLIP_ESC_END, 'b', SLIP_END, 'c', SLIP_END };
+    uint8_t memoryBlock[2 * 4];
+    Uart_RxBufferHandler handler = { .callback = testRxBufferCallback, .arg = &isCallbackCalled };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_DR);
+
+    Uart_readFramesAsync(&uart, memoryBlock, 4, 2, handler);
+    receiveLine(&uart, line, 7);
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_EQUAL(3, lastRxBufferLength);
+    CHECK_EQUAL(&memoryBlock[0], lastRxBuffer);
+    MEMCMP_EQUAL("a\xC0" "b", lastRxBuffer, 3);
+
+    receiveLine(&uart, &line[7], 2);
+    CHECK_EQUAL(1, lastRxBufferLength);
+    CHECK_EQUAL(&memoryBlock[4], lastRxBuffer);
+    CHECK_EQUAL(2, uart.rxBuffers.filledCount);
+}
+
+TEST(UartTests, Uart_readFramesAsync_ShouldDropOversizedAndMalformedFrames)
+{
+    const uint8_t line[] = { 'a', 'b', 'c', SLIP_END, 'd', SLIP_ESC, 'e', 'f', SLIP_END, 'g', 'h', SLIP_END };
+    uint8_t memoryBlock[2 * 2];
+    Uart_RxBufferHandler handler = { .callback = testRxBufferCallback, .arg = &isCallbackCalled };
+    Uart_Statistics statistics;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_DR);
+
+    Uart_readFramesAsync(&uart, memoryBlock, 2, 2, handler);
+    receiveLine(&uart, line, sizeof(line));
+
+    CHECK_EQUAL(1, uart.rxBuffers.filledCount);
+    CHECK_EQUAL(2, lastRxBufferLength);
+    MEMCMP_EQUAL("gh", lastRxBuffer, 2);
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(2, statistics.rxFrameErrors);
+}
+
+TEST(UartTests, Uart_readFramesAsync_ShouldDropFramesWhileAllBuffersAreOwned)
+{
+    const uint8_t line[] = { 'a', SLIP_END, 'b', 'c', SLIP_END, 'd', SLIP_END };
+    uint8_t memoryBlock[1 * 4];
+    Uart_RxBufferHandler handler = { .callback = testRxBufferCallback, .arg = &isCallbackCalled };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_DR);
+
+    Uart_readFramesAsync(&uart, memoryBlock, 4, 1, handler);
+    receiveLine(&uart, line, 5);
+    CHECK_EQUAL(1, uart.rxBuffers.filledCount);
+    CHECK_TRUE(uart.errorFlags.hasRxFifoFullErrorOccurred);
+
+    CHECK_TRUE(Uart_releaseRxBuffer(&uart));
+    receiveLine(&uart, &line[5], 2);
+    CHECK_EQUAL(2, uart.rxBuffers.filledCount);
+    CHECK_EQUAL('d', lastRxBuffer[0]);
+    CHECK_EQUAL(1, lastRxBufferLength);
+}
+
+TEST(UartTests, Uart_writeFramesAsync_ShouldDelimitEveryFrameIncludingEmptyOnes)
+{
+    const uint8_t payload[] = { SLIP_ESC };
+    const Uart_Buffer frames[] = { { .data = NULL, .length = 0 }, { .data = payload, .length = sizeof(payload) } };
+    const uint8_t expected[] = { SLIP_END, SLIP_END, SLIP_END, SLIP_ESC, SLIP_ESC_ESC, SLIP_END };
+    uint8_t line[sizeof(expected)] = { 0 };
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    Uart_writeFramesAsync(&uart, frames, 2, handler);
+    uart.reg->status = (1u << UART_STATUS_TS);
+    for (uint32_t i = 0; i < sizeof(line); i++) {
+        CHECK_FALSE(isCallbackCalled);
+        Uart_handleTx(&uart);
+        line[i] = (uint8_t)uart.reg->data;
+    }
+
+    MEMCMP_EQUAL(expected, line, sizeof(expected));
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+}
+
+TEST(UartTests, Uart_writeFramesAsync_ShouldCallCallbackAtOnceWithoutFrames)
+{
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TS);
+    uart.reg->data = 0;
+
+    Uart_writeFramesAsync(&uart, NULL, 0, handler);
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+    CHECK_EQUAL(0, uart.reg->data);
+}
+
+TEST(UartTests, Uart_getTxChecksum_ShouldCoverPayloadSentByInterruptHandler)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { '1', '2', '3', '4', '5', '6', '7', '8', '9' });
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_setChecksumType(&uart, Uart_ChecksumType_Crc32);
+    uart.reg->status = (1u << UART_STATUS_TS);
+
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+    for (int i = 0; i < 9; i++) {
+        Uart_handleTx(&uart);
+    }
+
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_EQUAL(0xCBF43926u, Uart_getTxChecksum(&uart));
+}
+
+TEST(UartTests, Uart_getLastRxChecksum_ShouldCoverDecodedPayloadOfEachFrame)
+{
+    const uint8_t line[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9', SLIP_END,
+                             'x', SLIP_ESC, 'y', SLIP_END, '1', '2', '3', '4', '5', '6', '7', '8', '9', SLIP_END };
+    uint8_t memoryBlock[2 * 16];
+    Uart_RxBufferHandler handler = { .callback = testRxBufferCallback, .arg = &isCallbackCalled };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_setChecksumType(&uart, Uart_ChecksumType_Crc16);
+    uart.reg->status = (1u << UART_STATUS_DR);
+
+    Uart_readFramesAsync(&uart, memoryBlock, 16, 2, handler);
+    receiveLine(&uart, line, 10);
+    CHECK_EQUAL(0x29B1u, Uart_getLastRxChecksum(&uart));
+
+    Uart_setChecksumType(&uart, Uart_ChecksumType_Crc32);
+    receiveLine(&uart, &line[10], sizeof(line) - 10u);
+    CHECK_EQUAL(0xCBF43926u, Uart_getLastRxChecksum(&uart));
+    CHECK_EQUAL(0u, Uart_getRxChecksum(&uart));
+}
+
+TEST(UartTests, Uart_getLastRxChecksum_ShouldMatchEachBufferHandedOverInOneInterrupt)
+{
+    const uint8_t line[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9', '9', '8', '7', '6', '5', '4', '3', '2', '1' };
+    uint8_t memoryBlock[2 * 9];
+    Uart_RxBufferHandler handler = { .callback = recordRxChecksum, .arg = NULL };
+    callbackChecksumCount = 0;
+    config.isRxEnabled = true;
+    config.isRxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_setChecksumType(&uart, Uart_ChecksumType_Crc32);
+    Uart_readBuffersAsync(&uart, memoryBlock, 9, 2, handler);
+    hookedLine = line;
+    hookedLineOffset = 0;
+    Uart_mockRegisterHooks.readData = readHookedLine;
+    uart.reg->status = (18u << UART_STATUS_RCNT_OFFSET) | (1u << UART_STATUS_DR);
+
+    CHECK_TRUE(Uart_handleRx(&uart));
+    CHECK_EQUAL(2, callbackChecksumCount);
+    CHECK_EQUAL(0xCBF43926u, callbackChecksums[0]);
+    CHECK_EQUAL(0x015F0201u, callbackChecksums[1]);
+}
+
+TEST(UartTests, Uart_getLastTxChecksum_ShouldMatchEachBufferCompletedInOneInterrupt)
+{
+    const uint8_t first[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    const uint8_t second[] = { 'a', 'b', 'c' };
+    const Uart_TxDescriptor descriptors[] = {
+        { .data = first, .length = sizeof(first), .handler = { .callback = recordTxChecksum, .arg = NULL } },
+        { .data = second, .length = sizeof(second), .handler = { .callback = recordTxChecksum, .arg = NULL } },
+    };
+    Uart_TxDescriptor queue[4];
+    callbackChecksumCount = 0;
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_setChecksumType(&uart, Uart_ChecksumType_Crc32);
+    uart.reg->status = (1u << UART_STATUS_TF);
+    Uart_writeQueueAsync(&uart, queue, 4);
+    CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptors[0]));
+    CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptors[1]));
+
+    uart.reg->status = 0;
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL(2, callbackChecksumCount);
+    CHECK_EQUAL(0xCBF43926u, callbackChecksums[0]);
+    CHECK_EQUAL(0x352441C2u, callbackChecksums[1]);
+}
+
+static uint32_t txDescriptorCompletions[4];
+static uint32_t txDescriptorCompletionCount;
+
+static void
+testTxDescriptorCallback(volatile void* arg)
+{
+    txDescriptorCompletions[txDescriptorCompletionCount++ % 4] = (uint32_t)(uintptr_t)arg;
+}
+
+TEST(UartTests, Uart_submitTxBuffer_ShouldChainQueuedBuffersAndCompleteEachOne)
+{
+    const uint8_t first[] = { 'a', 'b' };
+    const uint8_t second[] = { 'c' };
+    const Uart_TxDescriptor descriptors[] = {
+        { .data = first, .length = sizeof(first), .handler = { .callback = testTxDescriptorCallback, .arg = (void*)1 } },
+        { .data = NULL, .length = 0, .handler = { .callback = testTxDescriptorCallback, .arg = (void*)2 } },
+        { .data = second, .length = sizeof(second), .handler = { .callback = testTxDescriptorCallback, .arg = (void*)3 } },
+    };
+    Uart_TxDescriptor queue[2];
+    txDescriptorCompletionCount = 0;
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = 0;
+
+    Uart_writeQueueAsync(&uart, queue, 2);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+    CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptors[0]));
+    CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptors[1]));
+    CHECK_FALSE(Uart_submitTxBuffer(&uart, &descriptors[2]));
+
+    uart.reg->status = (1u << UART_STATUS_TS);
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL('a', uart.reg->data);
+    CHECK_EQUAL(0, txDescriptorCompletionCount);
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL('b', uart.reg->data);
+    CHECK_EQUAL(2, txDescriptorCompletionCount);
+    CHECK_EQUAL(1, txDescriptorCompletions[0]);
+    CHECK_EQUAL(2, txDescriptorCompletions[1]);
+    CHECK_TRUE(Uart_isTxEmpty(&uart));
+
+    CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptors[2]));
+    CHECK_EQUAL('c', uart.reg->data);
+    CHECK_EQUAL(3, txDescriptorCompletionCount);
+    CHECK_EQUAL(3, txDescriptorCompletions[2]);
+}
+
+TEST(UartTests, Uart_submitTxBuffer_ShouldContinueWithNextBufferInSameFillInTxBulkMode)
+{
+    const uint8_t first[] = { 'a', 'b' };
+    const uint8_t second[] = { 'c', 'd' };
+    const Uart_TxDescriptor descriptors[] = {
+        { .data = first, .length = sizeof(first), .handler = { .callback = testTxDescriptorCallback, .arg = (void*)1 } },
+        { .data = second, .length = sizeof(second), .handler = { .callback = testTxDescriptorCallback, .arg = (void*)2 } },
+    };
+    Uart_TxDescriptor queue[4];
+    txDescriptorCompletionCount = 0;
+    config.isTxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = (1u << UART_STATUS_TF);
+
+    Uart_writeQueueAsync(&uart, queue, 4);
+    CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptors[0]));
+    CHECK_TRUE(Uart_submitTxBuffer(&uart, &descriptors[1]));
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_EQUAL(0, txDescriptorCompletionCount);
+
+    uart.reg->status = 0;
+    CHECK_TRUE(Uart_handleTx(&uart));
+    CHECK_EQUAL('d', uart.reg->data);
+    CHECK_EQUAL(2, txDescriptorCompletionCount);
+    CHECK_FALSE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+}
+
+#ifdef UART_STATIC_PORTS
+TEST(UartTests, Uart_handleInterrupt0_ShouldServicePortLikeGenericHandler)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a', 'b' });
+    Uart_TxHandler handler = { .callback = testCallback, .arg = &isCallbackCalled };
+    Uart_Statistics statistics;
+    config.isTxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    uart.reg->status = 0;
+    Uart_writeAsync(&uart, &txByteFifo, handler);
+
+    uart.reg->status = (1u << UART_STATUS_TS);
+    Uart_handleInterrupt0(&uart);
+    CHECK_EQUAL('a', uart.reg->data);
+    Uart_handleInterrupt0(&uart);
+    CHECK_EQUAL('b', uart.reg->data);
+    CHECK_TRUE(isCallbackCalled);
+
+    Uart_getStatistics(&uart, &statistics);
+    CHECK_EQUAL(2, statistics.interrupts);
+    CHECK_EQUAL(2, statistics.txBytes);
+}
+#endif
+
+TEST(UartTests, Uart_handleRx_ShouldConsumeXonXoffAndSuspendTransmission)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a', 'b' });
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    Uart_TxHandler txHandler = { .callback = testCallback, .arg = &isCallbackCalled };
+    Uart_RxHandler rxHandler = { .lengthCallback = testCallback,
+                                 .characterCallback = testCallback,
+                                 .lengthArg = NULL,
+                                 .characterArg = NULL,
+                                 .targetCharacter = '\0',
+                                 .targetLength = 0 };
+    config.isTxEnabled = true;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readAsync(&uart, &rxByteFifo, rxHandler);
+    CHECK_TRUE(Uart_enableFlowControl(&uart, 8, 0));
+    uart.reg->status = 0;
+    Uart_writeAsync(&uart, &txByteFifo, txHandler);
+
+    uart.reg->data = UART_XOFF;
+    uart.reg->status = (1u << UART_STATUS_DR) | (1u << UART_STATUS_TS);
+    Uart_handleInterrupt(&uart);
+    CHECK_TRUE(Uart_isTxPaused(&uart));
+    CHECK_EQUAL(UART_XOFF, uart.reg->data);
+    CHECK_EQUAL(0, Uart_Fifo_getCount(&rxByteFifo));
+
+    uart.reg->data = UART_XON;
+    Uart_handleInterrupt(&uart);
+    CHECK_FALSE(Uart_isTxPaused(&uart));
+    CHECK_EQUAL('a', uart.reg->data);
+    CHECK_EQUAL(0, Uart_Fifo_getCount(&rxByteFifo));
+}
+
+TEST(UartTests, Uart_enableFlowControl_ShouldRejectInvalidWaterMarks)
+{
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    Uart_RxHandler rxHandler = { .lengthCallback = testCallback,
+                                 .characterCallback = testCallback,
+                                 .lengthArg = NULL,
+                                 .characterArg = NULL,
+                                 .targetCharacter = '\0',
+                                 .targetLength = 0 };
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+
+    CHECK_FALSE(Uart_enableFlowControl(&uart, 8, 0));
+    Uart_readAsync(&uart, &rxByteFifo, rxHandler);
+    CHECK_FALSE(Uart_enableFlowControl(&uart, 0, 0));
+    CHECK_FALSE(Uart_enableFlowControl(&uart, 4, 4));
+    CHECK_FALSE(Uart_enableFlowControl(&uart, 4, 6));
+    CHECK_FALSE(Uart_enableFlowControl(&uart, 9, 1));
+    CHECK_FALSE(uart.flowControl.isEnabled);
+
+    CHECK_TRUE(Uart_enableFlowControl(&uart, 8, 7));
+    CHECK_TRUE(uart.flowControl.isEnabled);
+}
+
+TEST(UartTests, Uart_updateFlowControl_ShouldSendXoffAtHighAndXonAtLowWaterMark)
+{
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    Uart_RxHandler rxHandler = { .lengthCallback = testCallback,
+                                 .characterCallback = testCallback,
+                                 .lengthArg = NULL,
+                                 .characterArg = NULL,
+                                 .targetCharacter = '\0',
+                                 .targetLength = 0 };
+    uint8_t byte = 0;
+    config.isTxEnabled = true;
+    config.isRxEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readAsync(&uart, &rxByteFifo, rxHandler);
+    CHECK_TRUE(Uart_enableFlowControl(&uart, 3, 1));
+
+    uart.reg->status = (1u << UART_STATUS_DR) | (1u << UART_STATUS_TS);
+    uart.reg->data = 'x';
+    Uart_handleInterrupt(&uart);
+    Uart_handleInterrupt(&uart);
+    CHECK_EQUAL('x', uart.reg->data);
+    Uart_handleInterrupt(&uart);
+    CHECK_EQUAL(UART_XOFF, uart.reg->data);
+    CHECK_EQUAL(3, Uart_Fifo_getCount(&rxByteFifo));
+
+    uart.reg->status = (1u << UART_STATUS_TS);
+    uart.reg->data = 0;
+    Uart_Fifo_pull(&rxByteFifo, &byte);
+    Uart_updateFlowControl(&uart);
+    CHECK_EQUAL(0, uart.reg->data);
+    Uart_Fifo_pull(&rxByteFifo, &byte);
+    Uart_updateFlowControl(&uart);
+    CHECK_EQUAL(UART_XON, uart.reg->data);
+}
+
+TEST(UartTests, Uart_handleRx_ShouldStopAndRestartFifoInterruptsOnXoffAndXonInTxBulkMode)
+{
+    UART_FIFO_CREATE_FILLED(txByteFifo, { 'a', 'b', 'c' });
+    UART_FIFO_CREATE(rxByteFifo, 8);
+    Uart_TxHandler txHandler = { .callback = testCallback, .arg = &isCallbackCalled };
+    Uart_RxHandler rxHandler = { .lengthCallback = testCallback,
+                                 .characterCallback = testCallback,
+                                 .lengthArg = NULL,
+                                 .characterArg = NULL,
+                                 .targetCharacter = '\0',
+                                 .targetLength = 0 };
+    config.isTxEnabled = true;
+    config.isRxEnabled = true;
+    config.isTxBulkModeEnabled = true;
+    Uart_setConfig(&uart, &config);
+    Uart_readAsync(&uart, &rxByteFifo, rxHandler);
+    CHECK_TRUE(Uart_enableFlowControl(&uart, 8, 0));
+    uart.reg->status = (1u << UART_STATUS_TF);
+    Uart_writeAsync(&uart, &txByteFifo, txHandler);
+    CHECK_TRUE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+
+    uart.reg->data = UART_XOFF;
+    uart.reg->status = (1u << UART_STATUS_DR);
+    Uart_handleInterrupt(&uart);
+    CHECK_TRUE(Uart_isTxPaused(&uart));
+    CHECK_FALSE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+    CHECK_EQUAL(3, Uart_Fifo_getCount(&txByteFifo));
+    CHECK_FALSE(isCallbackCalled);
+
+    uart.reg->data = UART_XON;
+    Uart_handleInterrupt(&uart);
+    CHECK_FALSE(Uart_isTxPaused(&uart));
+    CHECK_EQUAL('c', uart.reg->data);
+    CHECK_TRUE(isCallbackCalled);
+    CHECK_FALSE(Uart_getFlag(uart.reg->control, UART_CONTROL_TF));
+}
@@ -0,0 +1,91 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <string.h>
+#include <stdint.h>
+
+extern "C"
+{
+#include "ByteFifo.h"
+}
+
+TEST_GROUP(ByteFifoTests)
+{
+    uint8_t output[8];
+
+    void setup() {
+      memset(output, 0, sizeof(output));
+    }
+};
+
+TEST(ByteFifoTests, ByteFifo_pushBlock_ShouldCopyAsManyBytesAsFitInQueue)
+{
+    BYTE_FIFO_CREATE(fifo, 5);
+    const uint8_t data[] = { 1, 2, 3, 4, 5, 6, 7 };
+
+    CHECK_EQUAL(3, ByteFifo_pushBlock(&fifo, data, 3));
+    CHECK_EQUAL(3, ByteFifo_getCount(&fifo));
+    CHECK_EQUAL(2, ByteFifo_pushBlock(&fifo, data + 3, 4));
+    CHECK_TRUE(ByteFifo_isFull(&fifo));
+    CHECK_EQUAL(0, ByteFifo_pushBlock(&fifo, data, 1));
+
+    for (uint8_t i = 1; i <= 5; i++) {
+        uint8_t byte = 0;
+        CHECK_TRUE(ByteFifo_pull(&fifo, &byte));
+        CHECK_EQUAL(i, byte);
+    }
+    CHECK_TRUE(ByteFifo_isEmpty(&fifo));
+}
+
+TEST(ByteFifoTests, ByteFifo_pullBlock_ShouldCopyAsManyBytesAsAreQueued)
+{
+    BYTE_FIFO_CREATE_FILLED(fifo, { 1, 2, 3, 4, 5 });
+
+    CHECK_EQUAL(2, ByteFifo_pullBlock(&fifo, output, 2));
+    CHECK_EQUAL(3, ByteFifo_getCount(&fifo));
+    CHECK_EQUAL(3, ByteFifo_pullBlock(&fifo, output + 2, 6));
+    CHECK_TRUE(ByteFifo_isEmpty(&fifo));
+    CHECK_EQUAL(0, ByteFifo_pullBlock(&fifo, output, 1));
+
+    const uint8_t expected[] = { 1, 2, 3, 4, 5 };
+    CHECK_EQUAL(0, memcmp(expected, output, sizeof(expected)));
+}
+
+TEST(ByteFifoTests, ByteFifo_blockOperations_ShouldWrapAroundBufferEnd)
+{
+    BYTE_FIFO_CREATE(fifo, 5);
+    const uint8_t data[] = { 1, 2, 3, 4, 5, 6, 7 };
+
+    CHECK_EQUAL(4, ByteFifo_pushBlock(&fifo, data, 4));
+    CHECK_EQUAL(3, ByteFifo_pullBlock(&fifo, output, 3));
+    CHECK_EQUAL(3, ByteFifo_pushBlock(&fifo, data + 4, 3));
+    CHECK_EQUAL(4, ByteFifo_getCount(&fifo));
+
+    uint8_t byte = 0;
+    CHECK_TRUE(ByteFifo_push(&fifo, 8));
+    CHECK_TRUE(ByteFifo_isFull(&fifo));
+    CHECK_EQUAL(5, ByteFifo_pullBlock(&fifo, output, 8));
+    CHECK_FALSE(ByteFifo_pull(&fifo, &byte));
+
+    const uint8_t expected[] = { 4, 5, 6, 7, 8 };
+    CHECK_EQUAL(0, memcmp(expected, output, sizeof(expected)));
+}
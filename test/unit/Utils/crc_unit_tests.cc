@@ -0,0 +1,73 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <string.h>
+#include <stdint.h>
+
+extern "C"
+{
+#define CRC_USE_SLICE_BY_4
+#include "Crc.h"
+}
+
+static const uint8_t checkData[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+TEST_GROUP(CrcTests)
+{
+};
+
+TEST(CrcTests, Crc16_update_ShouldComputeCcittFalseCheckValue)
+{
+    CHECK_EQUAL(0x29B1u, Crc16_update(CRC16_INITIAL_VALUE, checkData, sizeof(checkData)));
+}
+
+TEST(CrcTests, Crc32_update_ShouldComputeIeeeCheckValue)
+{
+    CHECK_EQUAL(0xCBF43926u, Crc32_finalize(Crc32_update(CRC32_INITIAL_VALUE, checkData, sizeof(checkData))));
+}
+
+TEST(CrcTests, Crc32_update_ShouldMatchBytewiseComputationForAnySplit)
+{
+    uint8_t data[37];
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 29u + 3u);
+    }
+    uint32_t expected = CRC32_INITIAL_VALUE;
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        expected = Crc32_updateByte(expected, data[i]);
+    }
+
+    for (uint32_t split = 0; split <= sizeof(data); split++) {
+        const uint32_t crc = Crc32_update(CRC32_INITIAL_VALUE, data, split);
+        CHECK_EQUAL(expected, Crc32_update(crc, &data[split], sizeof(data) - split));
+    }
+}
+
+TEST(CrcTests, Crc16_updateByte_ShouldContinueBlockComputation)
+{
+    uint16_t crc = Crc16_update(CRC16_INITIAL_VALUE, checkData, 4);
+    for (uint32_t i = 4; i < sizeof(checkData); i++) {
+        crc = Crc16_updateByte(crc, checkData[i]);
+    }
+
+    CHECK_EQUAL(0x29B1u, crc);
+}
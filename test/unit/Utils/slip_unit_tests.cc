@@ -0,0 +1,108 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <string.h>
+#include <stdint.h>
+
+extern "C"
+{
+#include "Slip.h"
+}
+
+TEST_GROUP(SlipTests)
+{
+    SlipEncoder encoder;
+    SlipDecoder decoder;
+
+    void setup() {
+      SlipEncoder_reset(&encoder);
+      SlipDecoder_reset(&decoder);
+    }
+
+    uint32_t encode(const uint8_t* const input, const uint32_t length, uint8_t* const output) {
+      uint32_t count = 0;
+      for (uint32_t i = 0; i < length; i++) {
+        output[count++] = SlipEncoder_encode(&encoder, input[i]);
+        while (SlipEncoder_pullPending(&encoder, &output[count])) {
+          count++;
+        }
+      }
+      return count;
+    }
+};
+
+TEST(SlipTests, SlipEncoder_encode_ShouldPassPlainBytes)
+{
+    const uint8_t input[] = { 0x00, 0x41, 0xFF };
+    uint8_t output[8] = { 0 };
+
+    CHECK_EQUAL(sizeof(input), encode(input, sizeof(input), output));
+    MEMCMP_EQUAL(input, output, sizeof(input));
+}
+
+TEST(SlipTests, SlipEncoder_encode_ShouldEscapeDelimiterAndEscapeCharacter)
+{
+    const uint8_t input[] = { SLIP_END, 0x01, SLIP_ESC };
+    const uint8_t expected[] = { SLIP_ESC, SLIP_ESC_END, 0x01, SLIP_ESC, SLIP_ESC_ESC };
+    uint8_t output[8] = { 0 };
+
+    CHECK_EQUAL(sizeof(expected), encode(input, sizeof(input), output));
+    MEMCMP_EQUAL(expected, output, sizeof(expected));
+}
+
+TEST(SlipTests, SlipDecoder_decode_ShouldRestoreEscapedBytes)
+{
+    const uint8_t input[] = { 0x01, SLIP_ESC, SLIP_ESC_END, SLIP_ESC, SLIP_ESC_ESC };
+    const uint8_t expected[] = { 0x01, SLIP_END, SLIP_ESC };
+    uint8_t output[8] = { 0 };
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < sizeof(input); i++) {
+        if (SlipDecoder_decode(&decoder, input[i], &output[count]) == SlipDecoder_Result_Byte) {
+            count++;
+        }
+    }
+
+    CHECK_EQUAL(sizeof(expected), count);
+    MEMCMP_EQUAL(expected, output, sizeof(expected));
+    CHECK_EQUAL(SlipDecoder_Result_FrameEnd, SlipDecoder_decode(&decoder, SLIP_END, &output[0]));
+}
+
+TEST(SlipTests, SlipDecoder_decode_ShouldReportInvalidEscapeSequence)
+{
+    uint8_t payload = 0;
+
+    CHECK_EQUAL(SlipDecoder_Result_None, SlipDecoder_decode(&decoder, SLIP_ESC, &payload));
+    CHECK_EQUAL(SlipDecoder_Result_Error, SlipDecoder_decode(&decoder, 0x42, &payload));
+    CHECK_EQUAL(SlipDecoder_Result_Byte, SlipDecoder_decode(&decoder, 0x42, &payload));
+    CHECK_EQUAL(0x42, payload);
+}
+
+TEST(SlipTests, SlipDecoder_decode_ShouldEndFrameAfterDanglingEscape)
+{
+    uint8_t payload = 0;
+
+    CHECK_EQUAL(SlipDecoder_Result_None, SlipDecoder_decode(&decoder, SLIP_ESC, &payload));
+    CHECK_EQUAL(SlipDecoder_Result_FrameEnd, SlipDecoder_decode(&decoder, SLIP_END, &payload));
+    CHECK_EQUAL(SlipDecoder_Result_Byte, SlipDecoder_decode(&decoder, SLIP_ESC_END, &payload));
+    CHECK_EQUAL(SLIP_ESC_END, payload);
+}
@@ -0,0 +1,101 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute 
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <string.h>
+#include <stdint.h>
+
+extern "C"
+{
+#include "SpscFifo.h"
+}
+
+TEST_GROUP(SpscFifoTests)
+{
+    uint8_t output[8];
+
+    void setup() {
+      memset(output, 0, sizeof(output));
+    }
+};
+
+TEST(SpscFifoTests, SpscFifo_init_ShouldAcceptOnlyPowerOfTwoCapacity)
+{
+    uint8_t memoryBlock[8];
+    SpscFifo fifo;
+
+    CHECK_FALSE(SpscFifo_init(&fifo, memoryBlock, 0));
+    CHECK_FALSE(SpscFifo_init(&fifo, memoryBlock, 6));
+    CHECK_TRUE(SpscFifo_init(&fifo, memoryBlock, 8));
+    CHECK_EQUAL(8, SpscFifo_getCapacity(&fifo));
+    CHECK_TRUE(SpscFifo_isEmpty(&fifo));
+}
+
+TEST(SpscFifoTests, SpscFifo_pushAndPull_ShouldUseWholeCapacity)
+{
+    SPSC_FIFO_CREATE(fifo, 4);
+    uint8_t byte = 0;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        CHECK_TRUE(SpscFifo_push(&fifo, i));
+    }
+    CHECK_TRUE(SpscFifo_isFull(&fifo));
+    CHECK_FALSE(SpscFifo_push(&fifo, 4));
+
+    for (uint8_t i = 0; i < 4; i++) {
+        CHECK_TRUE(SpscFifo_pull(&fifo, &byte));
+        CHECK_EQUAL(i, byte);
+    }
+    CHECK_TRUE(SpscFifo_isEmpty(&fifo));
+    CHECK_FALSE(SpscFifo_pull(&fifo, &byte));
+}
+
+TEST(SpscFifoTests, SpscFifo_blockOperations_ShouldWrapAroundBufferEnd)
+{
+    SPSC_FIFO_CREATE(fifo, 4);
+    const uint8_t data[] = { 1, 2, 3, 4, 5, 6 };
+
+    CHECK_EQUAL(3, SpscFifo_pushBlock(&fifo, data, 3));
+    CHECK_EQUAL(2, SpscFifo_pullBlock(&fifo, output, 2));
+    CHECK_EQUAL(3, SpscFifo_pushBlock(&fifo, data + 3, 3));
+    CHECK_EQUAL(4, SpscFifo_getCount(&fifo));
+    CHECK_EQUAL(0, SpscFifo_pushBlock(&fifo, data, 1));
+    CHECK_EQUAL(4, SpscFifo_pullBlock(&fifo, output + 2, 8));
+
+    const uint8_t expected[] = { 1, 2, 3, 4, 5, 6 };
+    CHECK_EQUAL(0, memcmp(expected, output, sizeof(expected)));
+}
+
+TEST(SpscFifoTests, SpscFifo_getCount_ShouldHandleIndexOverflow)
+{
+    SPSC_FIFO_CREATE(fifo, 4);
+    uint8_t byte = 0;
+    fifo.head = UINT32_MAX;
+    fifo.tail = UINT32_MAX;
+
+    CHECK_TRUE(SpscFifo_push(&fifo, 1));
+    CHECK_TRUE(SpscFifo_push(&fifo, 2));
+    CHECK_EQUAL(2, SpscFifo_getCount(&fifo));
+    CHECK_TRUE(SpscFifo_pull(&fifo, &byte));
+    CHECK_EQUAL(1, byte);
+    CHECK_TRUE(SpscFifo_pull(&fifo, &byte));
+    CHECK_EQUAL(2, byte);
+}
@@ -1,8 +1,20 @@
 #include "rtems.h"
 
+#include <assert.h>
+#include <stddef.h>
+
+void ( *rtems_mock_event_receive_hook )( void ) = NULL;
+
+uint32_t rtems_mock_ticks_per_second = 0;
+uint32_t rtems_mock_processor_maximum = 2;
+rtems_vector_number rtems_mock_affinity_vector = 0;
+uint32_t rtems_mock_affinity_cpu = 0;
+
+static rtems_event_set pendingEvents = 0;
+
 uint32_t rtems_clock_get_ticks_per_second()
 {
-  return 0;
+  return rtems_mock_ticks_per_second;
 }
 
 void rtems_interrupt_entry_initialize(rtems_interrupt_entry *entry, rtems_interrupt_handler routine, void *arg, const char *info) {
@@ -42,3 +54,85 @@ rtems_status_code rtems_interrupt_clear( rtems_vector_number vector )
   (void)vector;
   return MOCK;
 }
+
+rtems_id rtems_task_self(void)
+{
+  return 1;
+}
+
+rtems_status_code rtems_event_send(rtems_id id, rtems_event_set event_in)
+{
+  (void)id;
+  pendingEvents |= event_in;
+  return RTEMS_SUCCESSFUL;
+}
+
+rtems_status_code rtems_event_receive(rtems_event_set event_in, rtems_option option_set, rtems_interval ticks, rtems_event_set *event_out)
+{
+  (void)ticks;
+  if (rtems_mock_event_receive_hook != NULL) {
+    rtems_mock_event_receive_hook();
+  }
+
+  const rtems_event_set received = pendingEvents & event_in;
+  const int isSatisfied = (option_set & RTEMS_EVENT_ANY) ? (received != 0) : (received == event_in);
+  *event_out = received;
+  if (!isSatisfied) {
+    return (option_set & RTEMS_NO_WAIT) ? RTEMS_UNSATISFIED : RTEMS_TIMEOUT;
+  }
+  pendingEvents &= ~received;
+  return RTEMS_SUCCESSFUL;
+}
+
+void rtems_interrupt_lock_initialize(rtems_interrupt_lock *lock, const char *name)
+{
+  (void)name;
+  lock->depth = 0;
+  lock->acquireCount = 0;
+}
+
+void rtems_interrupt_lock_acquire(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context)
+{
+  (void)context;
+  // Interrupt locks are not recursive, a nested acquire deadlocks on target
+  assert(lock->depth == 0);
+  lock->depth++;
+  lock->acquireCount++;
+}
+
+void rtems_interrupt_lock_release(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context)
+{
+  (void)context;
+  assert(lock->depth == 1);
+  lock->depth--;
+}
+
+void rtems_interrupt_lock_acquire_isr(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context)
+{
+  rtems_interrupt_lock_acquire(lock, context);
+}
+
+void rtems_interrupt_lock_release_isr(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context)
+{
+  rtems_interrupt_lock_release(lock, context);
+}
+
+uint32_t rtems_scheduler_get_processor_maximum(void)
+{
+  return rtems_mock_processor_maximum;
+}
+
+rtems_status_code rtems_interrupt_set_affinity(rtems_vector_number vector, size_t affinity_size, const cpu_set_t *affinity)
+{
+  if (affinity_size != sizeof(cpu_set_t)) {
+    return RTEMS_INVALID_NUMBER;
+  }
+  rtems_mock_affinity_vector = vector;
+  for (uint32_t cpu = 0; cpu < rtems_mock_processor_maximum; cpu++) {
+    if (CPU_ISSET((int)cpu, affinity)) {
+      rtems_mock_affinity_cpu = cpu;
+      return RTEMS_SUCCESSFUL;
+    }
+  }
+  return RTEMS_INVALID_NUMBER;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define RTEMS_INTERRUPT_UNIQUE 1u
@@ -8,17 +9,75 @@ typedef struct rtems_interrupt_entry {
   uint32_t mock;
 } rtems_interrupt_entry;
 
-typedef enum { MOCK
+#define RTEMS_WAIT 0x00000000u
+#define RTEMS_NO_WAIT 0x00000001u
+#define RTEMS_EVENT_ALL 0x00000000u
+#define RTEMS_EVENT_ANY 0x00000002u
+#define RTEMS_NO_TIMEOUT 0u
+#define RTEMS_EVENT_30 0x40000000u
+#define RTEMS_EVENT_31 0x80000000u
+
+typedef enum { MOCK = 0,
+  RTEMS_SUCCESSFUL = 0,
+  RTEMS_TIMEOUT = 6,
+  RTEMS_INVALID_NUMBER = 10,
+  RTEMS_UNSATISFIED = 13
 } rtems_status_code;
 
 typedef uint32_t rtems_option;
 typedef uint32_t rtems_vector_number;
+typedef uint32_t rtems_id;
+typedef uint32_t rtems_interval;
+typedef uint32_t rtems_event_set;
 typedef void ( *rtems_interrupt_handler )( void * );
 
+typedef struct rtems_interrupt_lock {
+  uint32_t depth;
+  uint32_t acquireCount;
+} rtems_interrupt_lock;
+
+typedef struct rtems_interrupt_lock_context {
+  uint32_t mock;
+} rtems_interrupt_lock_context;
+
+#define RTEMS_INTERRUPT_LOCK_MEMBER( _designator ) rtems_interrupt_lock _designator;
+
+#ifndef CPU_SETSIZE
+#define CPU_SETSIZE 32
+typedef struct {
+  uint32_t bits;
+} cpu_set_t;
+#define CPU_ZERO( _set ) ( ( _set )->bits = 0u )
+#define CPU_SET( _cpu, _set ) ( ( _set )->bits |= ( 1u << ( _cpu ) ) )
+#define CPU_ISSET( _cpu, _set ) ( ( ( _set )->bits >> ( _cpu ) ) & 1u )
+#endif
+
+/// \brief Value returned by rtems_clock_get_ticks_per_second.
+extern uint32_t rtems_mock_ticks_per_second;
+/// \brief Number of processors reported by rtems_scheduler_get_processor_maximum.
+extern uint32_t rtems_mock_processor_maximum;
+/// \brief Vector and processor passed to the last rtems_interrupt_set_affinity call.
+extern rtems_vector_number rtems_mock_affinity_vector;
+extern uint32_t rtems_mock_affinity_cpu;
+
+/// \brief Called by rtems_event_receive before checking pending events, allows
+///        tests to emulate interrupts arriving while a task is blocked.
+extern void ( *rtems_mock_event_receive_hook )( void );
+
 uint32_t rtems_clock_get_ticks_per_second();
 void rtems_interrupt_entry_initialize(rtems_interrupt_entry *entry, rtems_interrupt_handler routine, void *arg, const char *info);
 void rtems_interrupt_entry_install( rtems_vector_number vector, rtems_option options, rtems_interrupt_entry *entry);
 rtems_status_code rtems_interrupt_vector_enable(rtems_vector_number vector);
 rtems_status_code rtems_interrupt_vector_disable(rtems_vector_number vector);
 rtems_status_code rtems_interrupt_entry_remove(rtems_vector_number vector, rtems_interrupt_entry *entry);
-rtems_status_code rtems_interrupt_clear( rtems_vector_number vector );
\ No newline at end of file
+rtems_status_code rtems_interrupt_clear( rtems_vector_number vector );
+rtems_id rtems_task_self(void);
+rtems_status_code rtems_event_send(rtems_id id, rtems_event_set event_in);
+rtems_status_code rtems_event_receive(rtems_event_set event_in, rtems_option option_set, rtems_interval ticks, rtems_event_set *event_out);
+void rtems_interrupt_lock_initialize(rtems_interrupt_lock *lock, const char *name);
+void rtems_interrupt_lock_acquire(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context);
+void rtems_interrupt_lock_release(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context);
+void rtems_interrupt_lock_acquire_isr(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context);
+void rtems_interrupt_lock_release_isr(rtems_interrupt_lock *lock, rtems_interrupt_lock_context *context);
+uint32_t rtems_scheduler_get_processor_maximum(void);
+rtems_status_code rtems_interrupt_set_affinity(rtems_vector_number vector, size_t affinity_size, const cpu_set_t *affinity);
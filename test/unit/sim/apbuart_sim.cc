@@ -0,0 +1,341 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+#include "apbuart_sim.h"
+
+#include <string.h>
+#include <time.h>
+
+// Bounds back-to-back handler calls while a level interrupt stays asserted,
+// so that a handler which does not service the device cannot hang the test
+#define APBUART_SIM_INTERRUPT_STORM_LIMIT 64u
+
+#define APBUART_SIM_NO_EVENT UINT64_MAX
+
+// Start bit, 8 data bits and stop bit
+#define APBUART_SIM_FRAME_BITS 10u
+
+static ApbuartSim* attachedSims[Uart_Id_Invalid];
+
+static inline bool
+fifoPush(ApbuartSim_Fifo* const fifo, const uint32_t size, const uint8_t byte)
+{
+    if (fifo->count == size) {
+        return false;
+    }
+    fifo->data[(fifo->head + fifo->count) % APBUART_SIM_MAX_FIFO_SIZE] = byte;
+    fifo->count++;
+    return true;
+}
+
+static inline bool
+fifoPull(ApbuartSim_Fifo* const fifo, uint8_t* const byte)
+{
+    if (fifo->count == 0) {
+        return false;
+    }
+    *byte = fifo->data[fifo->head];
+    fifo->head = (fifo->head + 1u) % APBUART_SIM_MAX_FIFO_SIZE;
+    fifo->count--;
+    return true;
+}
+
+static inline bool
+isControlSet(const ApbuartSim* const sim, const uint32_t flag)
+{
+    return Uart_getFlag(sim->uart->reg->control, flag);
+}
+
+static inline uint64_t
+getNanoseconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+static void
+updateStatus(ApbuartSim* const sim)
+{
+    // Error flags are sticky until cleared by software
+    const uint32_t stickyMask = (1u << UART_STATUS_BR) | (1u << UART_STATUS_OV) | (1u << UART_STATUS_PE) |
+                                (1u << UART_STATUS_FE);
+    const uint32_t half = sim->fifoSize / 2u;
+    uint32_t status = sim->uart->reg->status & stickyMask;
+
+    status |= (sim->rxFifo.count > 0 ? 1u : 0u) << UART_STATUS_DR;
+    status |= (!sim->isShifting ? 1u : 0u) << UART_STATUS_TS;
+    status |= (sim->txFifo.count == 0 ? 1u : 0u) << UART_STATUS_TE;
+    status |= (sim->txFifo.count < half ? 1u : 0u) << UART_STATUS_TH;
+    status |= (sim->rxFifo.count >= half ? 1u : 0u) << UART_STATUS_RH;
+    status |= (sim->txFifo.count == sim->fifoSize ? 1u : 0u) << UART_STATUS_TF;
+    status |= (sim->rxFifo.count == sim->fifoSize ? 1u : 0u) << UART_STATUS_RF;
+    status |= (sim->txFifo.count << UART_STATUS_TCNT_OFFSET) & UART_STATUS_TCNT_MASK;
+    status |= (sim->rxFifo.count << UART_STATUS_RCNT_OFFSET) & UART_STATUS_RCNT_MASK;
+
+    sim->uart->reg->status = status;
+}
+
+static void
+startShift(ApbuartSim* const sim)
+{
+    if (sim->isShifting || !isControlSet(sim, UART_CONTROL_TE)) {
+        return;
+    }
+    if (fifoPull(&sim->txFifo, &sim->shiftRegister)) {
+        sim->isShifting = true;
+        sim->shiftEnd = sim->cycle + ApbuartSim_getFrameCycles(sim);
+    }
+}
+
+static void
+receiveFrame(ApbuartSim* const sim, const uint8_t byte)
+{
+    if (!isControlSet(sim, UART_CONTROL_RE)) {
+        return;
+    }
+
+    sim->statistics.rxFrameCount++;
+    if (!fifoPush(&sim->rxFifo, sim->fifoSize, byte)) {
+        sim->statistics.rxOverrunCount++;
+        sim->uart->reg->status |= 1u << UART_STATUS_OV;
+    }
+
+    if (!isControlSet(sim, UART_CONTROL_RI)) {
+        return;
+    }
+    if (isControlSet(sim, UART_CONTROL_DI)) {
+        sim->isRxIdlePending = true;
+        sim->rxIdleDeadline = sim->cycle + ApbuartSim_getFrameCycles(sim);
+    } else {
+        sim->isRxInterruptPending = true;
+    }
+}
+
+static void
+finishShift(ApbuartSim* const sim)
+{
+    sim->isShifting = false;
+    sim->statistics.txFrameCount++;
+
+    if (sim->txLine != NULL && sim->txLineLength < sim->txLineSize) {
+        sim->txLine[sim->txLineLength++] = sim->shiftRegister;
+    }
+    if (isControlSet(sim, UART_CONTROL_LB)) {
+        receiveFrame(sim, sim->shiftRegister);
+    }
+    if (isControlSet(sim, UART_CONTROL_TI)) {
+        sim->isTxInterruptPending = true;
+    }
+
+    startShift(sim);
+}
+
+static bool
+isInterruptAsserted(const ApbuartSim* const sim)
+{
+    const uint32_t half = sim->fifoSize / 2u;
+
+    if (sim->isTxInterruptPending || sim->isRxInterruptPending) {
+        return true;
+    }
+    if (isControlSet(sim, UART_CONTROL_TE) && isControlSet(sim, UART_CONTROL_TF) && sim->txFifo.count < half) {
+        return true;
+    }
+    return isControlSet(sim, UART_CONTROL_RE) && isControlSet(sim, UART_CONTROL_RF) && sim->rxFifo.count >= half;
+}
+
+static void
+serviceInterrupt(ApbuartSim* const sim)
+{
+    for (uint32_t i = 0; i < APBUART_SIM_INTERRUPT_STORM_LIMIT && isInterruptAsserted(sim); i++) {
+        sim->isTxInterruptPending = false;
+        sim->isRxInterruptPending = false;
+
+        const uint64_t start = getNanoseconds();
+        Uart_handleInterrupt(sim->uart);
+        sim->statistics.handlerNanoseconds += getNanoseconds() - start;
+        sim->statistics.interruptCount++;
+
+        startShift(sim);
+        updateStatus(sim);
+    }
+}
+
+static uint64_t
+getNextEvent(const ApbuartSim* const sim)
+{
+    uint64_t next = APBUART_SIM_NO_EVENT;
+
+    if (sim->isShifting && sim->shiftEnd < next) {
+        next = sim->shiftEnd;
+    }
+    if (sim->rxLineIndex < sim->rxLineLength && sim->rxNextArrival < next) {
+        next = sim->rxNextArrival;
+    }
+    if (sim->isRxIdlePending && sim->rxIdleDeadline < next) {
+        next = sim->rxIdleDeadline;
+    }
+
+    return next;
+}
+
+static void
+processEvents(ApbuartSim* const sim)
+{
+    if (sim->isShifting && sim->shiftEnd <= sim->cycle) {
+        finishShift(sim);
+    }
+    if (sim->rxLineIndex < sim->rxLineLength && sim->rxNextArrival <= sim->cycle) {
+        receiveFrame(sim, sim->rxLine[sim->rxLineIndex++]);
+        sim->rxNextArrival = sim->cycle + ApbuartSim_getFrameCycles(sim);
+    }
+    if (sim->isRxIdlePending && sim->rxIdleDeadline <= sim->cycle) {
+        sim->isRxIdlePending = false;
+        sim->isRxInterruptPending = true;
+    }
+
+    updateStatus(sim);
+    serviceInterrupt(sim);
+}
+
+static inline bool
+isIdle(const ApbuartSim* const sim)
+{
+    return !sim->isShifting && sim->txFifo.count == 0 && sim->rxLineIndex >= sim->rxLineLength &&
+           !sim->isRxIdlePending;
+}
+
+static bool
+runUntil(ApbuartSim* const sim, const uint64_t end, const bool shouldStopWhenIdle)
+{
+    startShift(sim);
+    updateStatus(sim);
+    serviceInterrupt(sim);
+
+    while (!shouldStopWhenIdle || !isIdle(sim)) {
+        const uint64_t next = getNextEvent(sim);
+        if (next == APBUART_SIM_NO_EVENT || next > end) {
+            sim->cycle = end;
+            return false;
+        }
+        sim->cycle = next;
+        processEvents(sim);
+    }
+
+    return true;
+}
+
+static uint8_t
+readDataHook(Uart* const uart)
+{
+    ApbuartSim* const sim = attachedSims[uart->id];
+    uint8_t byte = 0;
+
+    if (sim == NULL) {
+        return (uint8_t)uart->reg->data;
+    }
+
+    fifoPull(&sim->rxFifo, &byte);
+    updateStatus(sim);
+    return byte;
+}
+
+static void
+writeDataHook(Uart* const uart, const uint8_t data)
+{
+    ApbuartSim* const sim = attachedSims[uart->id];
+
+    if (sim == NULL) {
+        uart->reg->data = data;
+        return;
+    }
+
+    if (!fifoPush(&sim->txFifo, sim->fifoSize, data)) {
+        sim->statistics.txOverflowCount++;
+    }
+    startShift(sim);
+    updateStatus(sim);
+}
+
+void
+ApbuartSim_init(ApbuartSim* const sim, Uart* const uart, const uint32_t fifoSize, const uint32_t clockFrequency)
+{
+    memset(sim, 0, sizeof(*sim));
+    sim->uart = uart;
+    sim->fifoSize = fifoSize < APBUART_SIM_MAX_FIFO_SIZE ? fifoSize : APBUART_SIM_MAX_FIFO_SIZE;
+    sim->clockFrequency = clockFrequency;
+
+    attachedSims[uart->id] = sim;
+    Uart_mockRegisterHooks.readData = readDataHook;
+    Uart_mockRegisterHooks.writeData = writeDataHook;
+    updateStatus(sim);
+}
+
+void
+ApbuartSim_deinit(ApbuartSim* const sim)
+{
+    attachedSims[sim->uart->id] = NULL;
+
+    for (uint32_t i = 0; i < Uart_Id_Invalid; i++) {
+        if (attachedSims[i] != NULL) {
+            return;
+        }
+    }
+    Uart_mockRegisterHooks.readData = NULL;
+    Uart_mockRegisterHooks.writeData = NULL;
+}
+
+void
+ApbuartSim_captureTx(ApbuartSim* const sim, uint8_t* const buffer, const uint32_t size)
+{
+    sim->txLine = buffer;
+    sim->txLineSize = size;
+    sim->txLineLength = 0;
+}
+
+void
+ApbuartSim_receive(ApbuartSim* const sim, const uint8_t* const data, const uint32_t length)
+{
+    sim->rxLine = data;
+    sim->rxLineLength = length;
+    sim->rxLineIndex = 0;
+    sim->rxNextArrival = sim->cycle + ApbuartSim_getFrameCycles(sim);
+}
+
+uint64_t
+ApbuartSim_getFrameCycles(const ApbuartSim* const sim)
+{
+    const uint32_t scaler = (sim->uart->reg->clkscl & UART_SCALER_RELOAD_MASK) >> UART_SCALER_RELOAD_OFFSET;
+    const uint32_t parityBits = isControlSet(sim, UART_CONTROL_PE) ? 1u : 0u;
+    return (uint64_t)(scaler + 1u) * UART_CLKSCL_DIV * (APBUART_SIM_FRAME_BITS + parityBits);
+}
+
+void
+ApbuartSim_run(ApbuartSim* const sim, const uint64_t cycles)
+{
+    runUntil(sim, sim->cycle + cycles, false);
+}
+
+bool
+ApbuartSim_runUntilIdle(ApbuartSim* const sim, const uint64_t cycleLimit)
+{
+    return runUntil(sim, sim->cycle + cycleLimit, true);
+}
@@ -0,0 +1,143 @@
+/**@file
+ * This file is part of the Leon3 BSP for the Test Environment.
+ *
+ * @copyright 2022 N7 Space Sp. z o.o.
+ *
+ * Leon3 BSP for the Test Environment is free software: you can redistribute
+ * it and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.
+ *
+ * Leon3 BSP for the Test Environment is distributed in the hope
+ * that it will be useful, but WITHOUT ANY WARRANTY; without even
+ * the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Leon3 BSP for the Test Environment. If not,
+ * see <http://www.gnu.org/licenses/>.
+ */
+
+/// \brief Host-side behavioral model of the GRLIB APBUART.
+///
+/// The model keeps the hardware Tx and Rx FIFOs, the shift register and the
+/// line timing derived from the scaler register. It updates the status
+/// register of a Uart descriptor initialized with MOCK_REGISTERS and calls
+/// Uart_handleInterrupt whenever the modelled device would assert its
+/// interrupt. Time is counted in system clock cycles and advances only in
+/// ApbuartSim_run calls; interrupt handlers take no simulated time.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+extern "C"
+{
+#include "Uart.h"
+}
+
+/// \brief Maximum depth of the modelled hardware FIFOs.
+#define APBUART_SIM_MAX_FIFO_SIZE 32u
+
+/// \brief Depth of the hardware FIFOs of GR712RC APBUART.
+#define APBUART_SIM_GR712RC_FIFO_SIZE 8u
+
+/// \brief Hardware FIFO model.
+typedef struct
+{
+    uint8_t data[APBUART_SIM_MAX_FIFO_SIZE]; ///< FIFO storage
+    uint32_t head;                           ///< Index of the oldest byte
+    uint32_t count;                          ///< Number of stored bytes
+} ApbuartSim_Fifo;
+
+/// \brief Counters collected by the model.
+typedef struct
+{
+    uint32_t interruptCount;      ///< Uart_handleInterrupt invocations
+    uint32_t txFrameCount;        ///< Frames shifted out to the line
+    uint32_t rxFrameCount;        ///< Frames received from the line
+    uint32_t rxOverrunCount;      ///< Frames lost due to full Rx FIFO
+    uint32_t txOverflowCount;     ///< Writes lost due to full Tx FIFO
+    uint64_t handlerNanoseconds;  ///< Host time spent in the handler
+} ApbuartSim_Statistics;
+
+/// \brief APBUART model state.
+typedef struct
+{
+    Uart* uart;               ///< Driven Uart descriptor
+    uint32_t fifoSize;        ///< Depth of the hardware FIFOs
+    uint32_t clockFrequency;  ///< System clock frequency in Hz
+    uint64_t cycle;           ///< Current simulated time
+
+    ApbuartSim_Fifo txFifo;   ///< Hardware Tx FIFO
+    ApbuartSim_Fifo rxFifo;   ///< Hardware Rx FIFO
+
+    bool isShifting;          ///< Transmitter shift register busy
+    uint8_t shiftRegister;    ///< Frame being transmitted
+    uint64_t shiftEnd;        ///< End of the frame being transmitted
+
+    const uint8_t* rxLine;    ///< Bytes arriving on the Rx line
+    uint32_t rxLineLength;    ///< Number of bytes arriving on the Rx line
+    uint32_t rxLineIndex;     ///< Index of the next arriving byte
+    uint64_t rxNextArrival;   ///< End of the next arriving frame
+
+    bool isRxIdlePending;     ///< Delayed Rx interrupt waiting for idle line
+    uint64_t rxIdleDeadline;  ///< Time the Rx line is considered idle
+
+    bool isTxInterruptPending; ///< Frame transmitted interrupt pending
+    bool isRxInterruptPending; ///< Frame received interrupt pending
+
+    uint8_t* txLine;          ///< Capture buffer for transmitted bytes
+    uint32_t txLineSize;      ///< Size of the capture buffer
+    uint32_t txLineLength;    ///< Number of captured bytes
+
+    ApbuartSim_Statistics statistics; ///< Collected counters
+} ApbuartSim;
+
+/// \brief Attaches a model to an initialized Uart descriptor.
+/// \param [out] sim Model state.
+/// \param [in] uart Uart descriptor initialized with MOCK_REGISTERS.
+/// \param [in] fifoSize Depth of the hardware FIFOs.
+/// \param [in] clockFrequency System clock frequency in Hz.
+void ApbuartSim_init(ApbuartSim* const sim,
+                     Uart* const uart,
+                     const uint32_t fifoSize,
+                     const uint32_t clockFrequency);
+
+/// \brief Detaches a model from its Uart descriptor.
+/// \param [in] sim Model state.
+void ApbuartSim_deinit(ApbuartSim* const sim);
+
+/// \brief Sets a buffer capturing bytes shifted out to the Tx line.
+/// \param [in] sim Model state.
+/// \param [in] buffer Capture buffer.
+/// \param [in] size Size of the capture buffer.
+void ApbuartSim_captureTx(ApbuartSim* const sim,
+                          uint8_t* const buffer,
+                          const uint32_t size);
+
+/// \brief Starts back-to-back reception of bytes on the Rx line.
+/// \param [in] sim Model state.
+/// \param [in] data Bytes to receive, kept alive until received.
+/// \param [in] length Number of bytes to receive.
+void ApbuartSim_receive(ApbuartSim* const sim,
+                        const uint8_t* const data,
+                        const uint32_t length);
+
+/// \brief Gets duration of a single frame at current configuration.
+/// \param [in] sim Model state.
+/// \returns Frame duration in system clock cycles.
+uint64_t ApbuartSim_getFrameCycles(const ApbuartSim* const sim);
+
+/// \brief Advances simulated time, delivering all events on the way.
+/// \param [in] sim Model state.
+/// \param [in] cycles Number of system clock cycles to simulate.
+void ApbuartSim_run(ApbuartSim* const sim, const uint64_t cycles);
+
+/// \brief Advances simulated time until both lines become idle.
+/// \param [in] sim Model state.
+/// \param [in] cycleLimit Maximum number of system clock cycles to simulate.
+/// \retval true   lines idle
+/// \retval false  limit reached
+bool ApbuartSim_runUntilIdle(ApbuartSim* const sim, const uint64_t cycleLimit);